@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare searching a large sorted time column for the first time
+ * past random thresholds by scanning it, by skipping chunks with a
+ * chunk index, and by binary searching a chunk index declared sorted.
+ *
+ * usage: chunk_index_search.exe [elements] [chunk elements] [searches]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+template<typename F>
+double time_searches(Dataset& dataset, const std::vector<double>& thresholds, F make_test) {
+    // run one search per threshold, checking each finds the first time past it
+    return time_seconds([&]() {
+        for (const double threshold : thresholds) {
+            const int found = dataset.search<double>(make_test(threshold));
+            assert(found == static_cast<int>(threshold) + 1);
+        }
+    });
+}
+
+int main(int argc, char* argv[]) {
+    const int elements = (argc > 1) ? std::atoi(argv[1]) : 1 << 24;
+    const int chunk_size = (argc > 2) ? std::atoi(argv[2]) : 16384;
+    const int num_searches = (argc > 3) ? std::atoi(argv[3]) : 20;
+    const std::string filename = "bench_chunk_index.h5";
+
+    std::cout << elements << " sorted doubles in chunks of " << chunk_size << ", "
+              << num_searches << " searches" << std::endl;
+
+    std::vector<double> times(elements);
+    for (int i = 0; i < elements; ++i) times[i] = i;
+
+    File file(filename, FileMode::trunc);
+    file.create_dataset(Data<double>("Time", times), {chunk_size});
+    Dataset time = file.open_dataset("Time");
+
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<int> offsets(0, elements - 2);
+    std::vector<double> thresholds(num_searches);
+    for (auto& threshold : thresholds) threshold = offsets(generator) + 0.5;
+
+    const double t_scan = time_searches(time, thresholds, [](double t) {
+        return [=](double x) { return x > t; };
+    });
+    std::cout << "  scan:                " << t_scan << " s" << std::endl;
+
+    const double t_create = time_seconds([&]() { time.create_chunk_index<double>(); });
+    const double t_skip = time_searches(time, thresholds, [](double t) {
+        return ValueRange<double>::above(t);
+    });
+    std::cout << "  chunk index:         " << t_skip << " s, "
+              << t_scan / t_skip << "x faster, built in " << t_create << " s" << std::endl;
+
+    time.create_chunk_index<double>(true);
+    const double t_sorted = time_searches(time, thresholds, [](double t) {
+        return ValueRange<double>::above(t);
+    });
+    std::cout << "  sorted chunk index:  " << t_sorted << " s, "
+              << t_scan / t_sorted << "x faster" << std::endl;
+
+    return 0;
+}
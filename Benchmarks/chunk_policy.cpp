@@ -0,0 +1,136 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare chunk shapes chosen by ChunkPolicy against the current
+ * default of {256} for an appended 1D series, and against small
+ * hand-picked chunks for row, column and tile reads of a 2D field.
+ *
+ * usage: chunk_policy.exe [appends] [elements per append] [rows] [columns]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+std::string shape_string(const Shape& shape) {
+    std::string s = "{";
+    for (int i = 0; i < shape.size(); ++i) {
+        s += std::to_string(shape[i]) + ((i + 1 < shape.size()) ? ", " : "}");
+    }
+    return s;
+}
+
+void benchmark_append(int num_appends, int batch_size) {
+    const std::string filename = "bench_chunk_policy_append.h5";
+    std::vector<double> batch(batch_size, 1.0);
+
+    std::cout << "1D series: " << num_appends << " appends of " << batch_size << " doubles" << std::endl;
+
+    for (bool use_policy : {false, true}) {
+        double t_append, t_read;
+        Shape chunk_dims;
+
+        {
+            File file(filename, FileMode::trunc);
+            Dataset dataset = (use_policy) ?
+                file.create_dataset<double>("Series", {}, ChunkPolicy(AccessPattern::append)) :
+                file.create_dataset<double>("Series");
+            chunk_dims = dataset.chunk_dimensions();
+
+            t_append = time_seconds([&]() {
+                for (int i = 0; i < num_appends; ++i) {
+                    dataset.append(Data<double>("Series", {batch_size}, batch.data()));
+                }
+            });
+        }
+
+        {
+            File file(filename);
+            t_read = time_seconds([&]() {
+                const auto series = file.read_dataset<double>("Series");
+                assert(series.size() == static_cast<std::size_t>(num_appends) * batch_size);
+            });
+        }
+
+        std::cout << "  " << ((use_policy) ? "policy  " : "default ") << shape_string(chunk_dims)
+                  << "  append: " << t_append << " s  read: " << t_read << " s" << std::endl;
+    }
+}
+
+void benchmark_field(int rows, int columns) {
+    const std::string filename = "bench_chunk_policy_field.h5";
+
+    std::vector<float> field(static_cast<std::size_t>(rows) * columns);
+    for (std::size_t i = 0; i < field.size(); ++i) field[i] = i;
+
+    std::cout << "2D field: " << rows << " x " << columns << " floats" << std::endl;
+
+    const std::vector<std::pair<std::string, Shape>> chunk_choices = {
+        {"small   ", {16, 16}},
+        {"rows    ", ChunkPolicy(AccessPattern::rows).choose({rows, columns}, sizeof(float))},
+        {"columns ", ChunkPolicy(AccessPattern::columns).choose({rows, columns}, sizeof(float))},
+        {"tiles   ", ChunkPolicy(AccessPattern::tiles).choose({rows, columns}, sizeof(float))}
+    };
+
+    const int row_block = 16;
+    const int column_block = 16;
+    const int tile = 128;
+
+    for (const auto& choice : chunk_choices) {
+        {
+            File file(filename, FileMode::trunc);
+            file.create_dataset(Data<float>("Field", {rows, columns}, field.data()), choice.second);
+        }
+
+        File file(filename);
+        Dataset dataset = file.open_dataset("Field");
+
+        const double t_rows = time_seconds([&]() {
+            for (int i = 0; i + row_block <= rows; i += row_block) {
+                dataset.read<float>({i, 0}, {row_block, columns});
+            }
+        });
+
+        const double t_columns = time_seconds([&]() {
+            for (int j = 0; j + column_block <= columns; j += column_block) {
+                dataset.read<float>({0, j}, {rows, column_block});
+            }
+        });
+
+        const double t_tiles = time_seconds([&]() {
+            for (int i = 0; i + tile <= rows; i += tile) {
+                for (int j = 0; j + tile <= columns; j += tile) {
+                    dataset.read<float>({i, j}, {tile, tile});
+                }
+            }
+        });
+
+        std::cout << "  " << choice.first << shape_string(choice.second)
+                  << "  row reads: " << t_rows << " s"
+                  << "  column reads: " << t_columns << " s"
+                  << "  tile reads: " << t_tiles << " s" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int num_appends = (argc > 1) ? std::atoi(argv[1]) : 5000;
+    const int batch_size = (argc > 2) ? std::atoi(argv[2]) : 20;
+    const int rows = (argc > 3) ? std::atoi(argv[3]) : 4096;
+    const int columns = (argc > 4) ? std::atoi(argv[4]) : 1024;
+
+    benchmark_append(num_appends, batch_size);
+    benchmark_field(rows, columns);
+
+    return 0;
+}
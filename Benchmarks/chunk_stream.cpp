@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare processing a gzip-compressed 2D dataset block by block with
+ * blocking reads against a ChunkStream that reads the next blocks on a
+ * background thread while the current block is processed.
+ *
+ * usage: chunk_stream.exe [rows] [columns] [chunk rows] [compute passes] [prefetch depth]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+double process(const double* values, std::size_t size, int passes) {
+    // stand-in for the work an analysis does on each block
+    double sum = 0.0;
+    for (int p = 0; p < passes; ++p) {
+        for (std::size_t i = 0; i < size; ++i) sum += std::sqrt(std::abs(values[i]) + p);
+    }
+    return sum;
+}
+
+int main(int argc, char* argv[]) {
+    const int rows = (argc > 1) ? std::atoi(argv[1]) : 65536;
+    const int columns = (argc > 2) ? std::atoi(argv[2]) : 64;
+    const int chunk_rows = (argc > 3) ? std::atoi(argv[3]) : 2048;
+    const int passes = (argc > 4) ? std::atoi(argv[4]) : 4;
+    const int prefetch_depth = (argc > 5) ? std::atoi(argv[5]) : 2;
+    const std::string filename = "bench_chunk_stream.h5";
+
+    {
+        std::vector<double> field(static_cast<std::size_t>(rows) * columns);
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < columns; ++j) {
+                field[static_cast<std::size_t>(i) * columns + j] =
+                    std::round(1000.0 * std::sin(0.001 * i) * std::cos(0.1 * j)) / 1000.0;
+            }
+        }
+
+        File file(filename, FileMode::trunc);
+        file.create_dataset(Data<double>("Field", {rows, columns}, field.data()), {chunk_rows, columns}, 6);
+    }
+
+    File file(filename);
+    Dataset dataset = file.open_dataset("Field");
+
+    std::cout << "dataset: " << rows << " x " << columns << " doubles, "
+              << chunk_rows << " row chunks, " << passes << " compute passes per block" << std::endl;
+
+    // read each block, then process it
+    double sum_blocking = 0.0;
+    const double t_blocking = time_seconds([&]() {
+        for (int offset = 0; offset < rows; offset += chunk_rows) {
+            const int length = std::min(chunk_rows, rows - offset);
+            const auto block = dataset.read<double>({offset, 0}, {length, columns});
+            sum_blocking += process(block.data(), block.size(), passes);
+        }
+    });
+
+    // process each block while the stream reads ahead
+    double sum_stream = 0.0;
+    const double t_stream = time_seconds([&]() {
+        ChunkStream<double> stream(dataset, 0, prefetch_depth, chunk_rows);
+        for (const auto& block : stream) {
+            sum_stream += process(block.data, block.size, passes);
+        }
+    });
+
+    assert(sum_blocking == sum_stream);
+
+    std::cout << "  blocking reads:             " << t_blocking << " s" << std::endl;
+    std::cout << "  ChunkStream, prefetch " << prefetch_depth << ":    " << t_stream << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare appending particle records every step as one dataset of
+ * compound records against one dataset per field, appending to
+ * each field separately.
+ *
+ * usage: compound_append.exe [particles per step] [steps]
+ */
+
+struct Particle {
+    long long id;
+    double position[3];
+    double velocity[3];
+    unsigned int flags;
+};
+CLASSY_HDF_COMPOUND(Particle, id, position, velocity, flags)
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int particles = (argc > 1) ? std::atoi(argv[1]) : 256;
+    const int steps = (argc > 2) ? std::atoi(argv[2]) : 2000;
+    const std::string filename = "bench_compound_append.h5";
+
+    std::vector<Particle> records(particles);
+    std::vector<long long> ids(particles);
+    std::vector<double> positions(3 * particles);
+    std::vector<double> velocities(3 * particles);
+    std::vector<unsigned int> flags(particles);
+    for (int i = 0; i < particles; ++i) {
+        records[i].id = ids[i] = i;
+        for (int k = 0; k < 3; ++k) {
+            records[i].position[k] = positions[3 * i + k] = i + k;
+            records[i].velocity[k] = velocities[3 * i + k] = -i - k;
+        }
+        records[i].flags = flags[i] = i % 7;
+    }
+
+    std::cout << steps << " steps of " << particles << " particles ("
+              << steps * particles * sizeof(Particle) / 1048576.0 << " MiB)" << std::endl;
+
+    const double t_fields = time_seconds([&]() {
+        File file(filename, FileMode::trunc);
+        Dataset d_ids = file.create_dataset<long long>("id", {0}, {particles});
+        Dataset d_positions = file.create_dataset<double>("position", {0, 3}, {particles, 3});
+        Dataset d_velocities = file.create_dataset<double>("velocity", {0, 3}, {particles, 3});
+        Dataset d_flags = file.create_dataset<unsigned int>("flags", {0}, {particles});
+
+        for (int step = 0; step < steps; ++step) {
+            d_ids.append(Data<long long>("id", ids));
+            d_positions.append(Data<double>("position", {particles, 3}, positions.data()));
+            d_velocities.append(Data<double>("velocity", {particles, 3}, velocities.data()));
+            d_flags.append(Data<unsigned int>("flags", flags));
+        }
+    });
+
+    const double t_records = time_seconds([&]() {
+        File file(filename, FileMode::trunc);
+        Dataset d_particles = file.create_dataset<Particle>("Particles", {0}, {particles});
+
+        for (int step = 0; step < steps; ++step) {
+            d_particles.append(Data<Particle>("Particles", records));
+        }
+    });
+
+    std::cout << "  one dataset per field:   " << t_fields << " s" << std::endl;
+    std::cout << "  compound records:        " << t_records << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare strided (column by column) reads of a wide, compressed
+ * 2D dataset using the default 1 MiB chunk cache against a chunk
+ * cache sized to hold a full band of chunks, set for the whole
+ * file and for the single dataset.
+ *
+ * usage: file_options.exe [rows] [columns] [chunk size] [columns to read]
+ */
+
+void write_benchmark_file(const std::string& filename, int rows, int columns, int chunk_size) {
+    File file(filename, FileMode::trunc);
+
+    std::vector<double> field(static_cast<std::size_t>(rows) * columns);
+    for (std::size_t i = 0; i < field.size(); ++i) field[i] = 0.001 * (i % 100003);
+
+    const int compression_level = 1;
+    file.create_dataset(Data<double>("Field", {rows, columns}, field.data()),
+                        {chunk_size, chunk_size}, compression_level);
+}
+
+double read_columns(Dataset& dataset, int num_columns) {
+    // read the dataset one column at a time, returning the time taken
+    const int rows = dataset.dimensions()[0];
+
+    const auto start = std::chrono::steady_clock::now();
+
+    double checksum = 0.0;
+    for (int j = 0; j < num_columns; ++j) {
+        const auto column = dataset.read<double>({0, j}, {rows, 1});
+        checksum += column[rows / 2];
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+    assert(checksum >= 0.0);
+
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int rows = (argc > 1) ? std::atoi(argv[1]) : 4096;
+    const int columns = (argc > 2) ? std::atoi(argv[2]) : 1024;
+    const int chunk_size = (argc > 3) ? std::atoi(argv[3]) : 256;
+    const int columns_to_read = (argc > 4) ? std::atoi(argv[4]) : 128;
+    const std::string filename = "bench_file_options.h5";
+
+    write_benchmark_file(filename, rows, columns, chunk_size);
+
+    // a chunk cache big enough for every chunk one column passes through
+    const std::size_t chunk_bytes = sizeof(double) * chunk_size * chunk_size;
+    const int chunks_per_column = (rows + chunk_size - 1) / chunk_size;
+    const std::size_t cache_bytes = 2 * chunks_per_column * chunk_bytes;
+    const std::size_t cache_slots = 100 * 2 * chunks_per_column + 1;
+
+    std::cout << "dataset: " << rows << " x " << columns << " doubles, "
+              << chunk_size << " x " << chunk_size << " chunks, reading "
+              << columns_to_read << " columns" << std::endl;
+
+    {
+        File file(filename);
+        Dataset dataset = file.open_dataset("Field");
+        std::cout << "  default chunk cache:        " << read_columns(dataset, columns_to_read)
+                  << " s" << std::endl;
+    }
+
+    {
+        File file(filename, FileMode::rw, FileOptions().chunk_cache(cache_bytes, cache_slots));
+        Dataset dataset = file.open_dataset("Field");
+        std::cout << "  file chunk cache " << (cache_bytes >> 20) << " MiB:    "
+                  << read_columns(dataset, columns_to_read) << " s" << std::endl;
+    }
+
+    {
+        File file(filename);
+        Dataset dataset = file.open_dataset("Field",
+                                            DatasetAccessOptions().chunk_cache(cache_bytes, cache_slots));
+        std::cout << "  dataset chunk cache " << (cache_bytes >> 20) << " MiB: "
+                  << read_columns(dataset, columns_to_read) << " s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Measure write and read throughput and the compression ratio of
+ * several filter pipelines on a smooth noisy floating-point field and
+ * on slowly varying integer counters. Plugin filters that are not
+ * installed (see HDF5_PLUGIN_PATH) are reported and skipped.
+ *
+ * usage: filter_pipelines.exe [elements] [chunk elements]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+struct NamedPipeline {
+    std::string name;
+    FilterPipeline pipeline;
+    bool lossy;
+};
+
+template<typename T>
+void measure(const std::string& filename, const std::vector<T>& values, int chunk_size,
+             const std::vector<NamedPipeline>& pipelines)
+{
+    const double megabytes = values.size() * sizeof(T) / 1.0e6;
+
+    for (const auto& named : pipelines) {
+        bool available = true;
+        for (const auto& filter : named.pipeline.filters()) {
+            available = available && FilterPipeline::available(filter.id);
+        }
+        if (!available) {
+            std::cout << "  " << named.name << ": not available" << std::endl;
+            continue;
+        }
+
+        hsize_t stored_bytes = 0;
+        const double t_write = time_seconds([&]() {
+            File file(filename, FileMode::trunc);
+            std::vector<T> copy = values;
+            Dataset dataset = file.create_dataset(Data<T>("Values", copy), {chunk_size}, named.pipeline);
+            stored_bytes = dataset.storage_size();
+        });
+
+        std::vector<T> read_values;
+        const double t_read = time_seconds([&]() {
+            File file(filename);
+            read_values = file.read_dataset<T>("Values");
+        });
+        assert(named.lossy || read_values == values);
+
+        std::cout << "  " << named.name << ": write " << megabytes / t_write << " MB/s, read "
+                  << megabytes / t_read << " MB/s, ratio " << values.size() * sizeof(T) / double(stored_bytes)
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int elements = (argc > 1) ? std::atoi(argv[1]) : 4 << 20;
+    const int chunk_size = (argc > 2) ? std::atoi(argv[2]) : 65536;
+    const std::string filename = "bench_filter_pipelines.h5";
+
+    std::mt19937 generator(12345);
+    std::normal_distribution<double> noise(0.0, 1.0e-4);
+
+    std::vector<double> field(elements);
+    std::vector<int> counts(elements);
+    for (int i = 0; i < elements; ++i) {
+        field[i] = std::sin(1.0e-4 * i) + noise(generator);
+        counts[i] = 1000000 + i / 16 + (i % 3);
+    }
+
+    const std::vector<NamedPipeline> pipelines = {
+        {"none                 ", FilterPipeline(), false},
+        {"gzip 1               ", FilterPipeline().deflate(1), false},
+        {"gzip 6               ", FilterPipeline().deflate(6), false},
+        {"shuffle + gzip 1     ", FilterPipeline().shuffle().deflate(1), false},
+        {"shuffle + fletcher32 ", FilterPipeline().shuffle().fletcher32(), false},
+        {"shuffle + lz4        ", FilterPipeline().shuffle().lz4(0, false), false},
+        {"bitshuffle + lz4     ", FilterPipeline().bitshuffle(true, 0, false), false},
+        {"shuffle + zstd 3     ", FilterPipeline().shuffle().zstd(3, false), false},
+    };
+
+    std::cout << elements << " elements in chunks of " << chunk_size << std::endl;
+
+    std::cout << "double field:" << std::endl;
+    std::vector<NamedPipeline> field_pipelines = pipelines;
+    field_pipelines.push_back({"scale-offset 4 + gzip 1 (lossy)",
+                               FilterPipeline().scale_offset(H5Z_SO_FLOAT_DSCALE, 4).deflate(1), true});
+    measure(filename, field, chunk_size, field_pipelines);
+
+    std::cout << "int counters:" << std::endl;
+    std::vector<NamedPipeline> count_pipelines = pipelines;
+    count_pipelines.push_back({"scale-offset         ",
+                               FilterPipeline().scale_offset(H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT), false});
+    count_pipelines.push_back({"scale-offset + gzip 1",
+                               FilterPipeline().scale_offset(H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT).deflate(1), false});
+    measure(filename, counts, chunk_size, count_pipelines);
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare appending a record to each of a few hundred datasets by
+ * name, as a simulation writing diagnostics every step would, with
+ * and without a handle cache on the file.
+ *
+ * usage: handle_cache.exe [datasets] [steps]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+void create_datasets(const std::string& filename, int num_datasets) {
+    File file(filename, FileMode::trunc);
+    auto groups = file.get_nested_groups({"Diagnostics", "Scalars"});
+    for (int i = 0; i < num_datasets; ++i) {
+        groups.back().create_dataset<double>("quantity_" + std::to_string(i), {0}, {1024});
+    }
+}
+
+double append_steps(const std::string& filename, int num_datasets, int num_steps, const FileOptions& options) {
+    return time_seconds([&]() {
+        File file(filename, FileMode::rw, options);
+        for (int step = 0; step < num_steps; ++step) {
+            // look up the group and each dataset by name every step
+            auto groups = file.get_nested_groups({"Diagnostics", "Scalars"});
+            Group& scalars = groups.back();
+            for (int i = 0; i < num_datasets; ++i) {
+                std::vector<double> value = {static_cast<double>(step)};
+                scalars.append(Data<double>("quantity_" + std::to_string(i), value));
+            }
+        }
+    });
+}
+
+int main(int argc, char* argv[]) {
+    const int num_datasets = (argc > 1) ? std::atoi(argv[1]) : 200;
+    const int num_steps = (argc > 2) ? std::atoi(argv[2]) : 100;
+    const std::string filename = "bench_handle_cache.h5";
+
+    std::cout << num_datasets << " datasets, " << num_steps << " steps of one append each" << std::endl;
+
+    create_datasets(filename, num_datasets);
+    const double t_plain = append_steps(filename, num_datasets, num_steps, FileOptions());
+    std::cout << "  no handle cache:       " << t_plain << " s" << std::endl;
+
+    create_datasets(filename, num_datasets);
+    FileOptions options = FileOptions().handle_cache(num_datasets + 2);
+    const double t_cached = append_steps(filename, num_datasets, num_steps, options);
+    std::cout << "  handle cache:          " << t_cached << " s" << std::endl;
+
+    {
+        File file(filename);
+        const auto values = file.read_dataset<double>("/Diagnostics/Scalars/quantity_0");
+        assert(static_cast<int>(values.size()) == num_steps);
+    }
+
+    return 0;
+}
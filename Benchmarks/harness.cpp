@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Time single calls of the common operations (append, read, search,
+ * create and open) at configurable sizes, and report the throughput
+ * and the latency percentiles of each. Random offsets come from a
+ * fixed seed so runs are reproducible.
+ *
+ * built with CLASSY_HDF_INSTRUMENT (harness_instrumented.exe), it also
+ * writes the I/O counts ClassyHDF collected to bench_harness_io.json,
+ * and comparing the two shows the cost of the instrumentation.
+ *
+ * usage: harness.exe [elements] [elements per call] [repeats] [chunk elements]
+ */
+
+class LatencyRecorder {
+    private:
+        std::string m_name;
+        std::vector<double> m_seconds;
+        std::size_t m_bytes;
+    public:
+        LatencyRecorder(const std::string& name) : m_name(name), m_bytes(0) {}
+
+        template<typename F>
+        void time(std::size_t bytes, F function) {
+            // time one call of function, which moves [bytes]
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto stop = std::chrono::steady_clock::now();
+            m_seconds.push_back(std::chrono::duration<double>(stop - start).count());
+            m_bytes += bytes;
+        }
+
+        void report() {
+            std::sort(m_seconds.begin(), m_seconds.end());
+            double total = 0;
+            for (const double s : m_seconds) total += s;
+
+            auto percentile = [&](double p) {
+                const std::size_t i = std::min(m_seconds.size() - 1,
+                                               static_cast<std::size_t>(p * m_seconds.size()));
+                return 1.0e6 * m_seconds[i];
+            };
+
+            std::cout << "  " << std::left << std::setw(8) << m_name << std::right
+                      << std::setw(8) << m_seconds.size() << " calls" << std::fixed << std::setprecision(1)
+                      << std::setw(10) << (m_bytes > 0 ? m_bytes / total / 1.0e6 : 0.0) << " MB/s"
+                      << "  p50 " << std::setw(9) << percentile(0.5) << " us"
+                      << "  p90 " << std::setw(9) << percentile(0.9) << " us"
+                      << "  p99 " << std::setw(9) << percentile(0.99) << " us"
+                      << "  max " << std::setw(9) << 1.0e6 * m_seconds.back() << " us" << std::endl;
+        }
+};
+
+int main(int argc, char* argv[]) {
+    const int elements = (argc > 1) ? std::atoi(argv[1]) : 1 << 22;
+    const int batch = (argc > 2) ? std::atoi(argv[2]) : 4096;
+    const int repeats = (argc > 3) ? std::atoi(argv[3]) : 1000;
+    const int chunk_size = (argc > 4) ? std::atoi(argv[4]) : 65536;
+    const std::string filename = "bench_harness.h5";
+
+    std::cout << "harness: " << elements << " doubles, " << batch << " per call, "
+              << repeats << " repeats, chunks of " << chunk_size
+#ifdef CLASSY_HDF_INSTRUMENT
+              << ", instrumented"
+#endif
+              << std::endl;
+
+    std::mt19937 generator(12345);
+    std::vector<double> values(batch);
+
+    File file(filename, FileMode::trunc, FileOptions().io_report("bench_harness_io.json", IOReportFormat::json));
+    file.create_dataset<double>("Values", {0}, {chunk_size});
+    Dataset dataset = file.open_dataset("Values");
+
+    // append the dataset one batch at a time
+    LatencyRecorder append("append");
+    for (int offset = 0; offset < elements; offset += batch) {
+        for (int i = 0; i < batch; ++i) values[i] = offset + i;
+        append.time(batch * sizeof(double), [&]() {
+            dataset.append(Data<double>("Values", values));
+        });
+    }
+    append.report();
+
+    // read batches at random offsets
+    const int length = dataset.dimensions()[0];
+    std::uniform_int_distribution<int> offsets(0, length - batch);
+    LatencyRecorder read("read");
+    for (int r = 0; r < repeats; ++r) {
+        const int offset = offsets(generator);
+        read.time(batch * sizeof(double), [&]() {
+            dataset.read(Shape({offset}), Shape({batch}), values.data(), values.size());
+        });
+        assert(values[0] == offset);
+    }
+    read.report();
+
+    // search for the first value past a random threshold, reading up to it
+    LatencyRecorder search("search");
+    for (int r = 0; r < std::max(1, repeats / 100); ++r) {
+        const int target = offsets(generator);
+        int found = -1;
+        search.time(target * sizeof(double), [&]() {
+            found = dataset.search<double>([=](double x) { return x >= target; });
+        });
+        assert(found == target);
+    }
+    search.report();
+
+    // create small datasets, then open them again by name
+    LatencyRecorder create("create");
+    for (int r = 0; r < repeats; ++r) {
+        create.time(0, [&]() {
+            file.create_dataset<double>("Small_" + std::to_string(r), {0}, {256});
+        });
+    }
+    create.report();
+
+    LatencyRecorder open("open");
+    std::uniform_int_distribution<int> names(0, repeats - 1);
+    for (int r = 0; r < repeats; ++r) {
+        const std::string name = "Small_" + std::to_string(names(generator));
+        open.time(0, [&]() {
+            Dataset small = file.open_dataset(name);
+        });
+    }
+    open.report();
+
+    return 0;
+}
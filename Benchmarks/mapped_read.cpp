@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare reading a contiguous 1D dataset with read<T>() against
+ * mapping it with map<T>(), timing both how long it takes to get
+ * at the data and how long it takes to sum every element.
+ *
+ * usage: mapped_read.exe [elements]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int elements = (argc > 1) ? std::atoi(argv[1]) : 16 * 1024 * 1024;
+    const std::string filename = "bench_mapped_read.h5";
+
+    {
+        std::vector<double> field(elements);
+        std::iota(field.begin(), field.end(), 0.0);
+
+        File file(filename, FileMode::trunc);
+        file.create_dataset(Data<double>("Field", field), {});
+    }
+
+    File file(filename);
+    Dataset dataset = file.open_dataset("Field");
+
+    std::cout << "dataset: " << elements << " doubles ("
+              << elements * sizeof(double) / 1048576.0 << " MiB), contiguous" << std::endl;
+
+    std::vector<double> datavec;
+    const double t_read_open = time_seconds([&]() { datavec = dataset.read<double>(); });
+    double sum_read = 0.0;
+    const double t_read_sum = time_seconds([&]() {
+        sum_read = std::accumulate(datavec.begin(), datavec.end(), 0.0);
+    });
+
+    MappedView<double> view;
+    const double t_map_open = time_seconds([&]() { view = dataset.map<double>(MapAccess::sequential); });
+    double sum_map = 0.0;
+    const double t_map_sum = time_seconds([&]() {
+        sum_map = std::accumulate(view.begin(), view.end(), 0.0);
+    });
+
+    assert(view.mapped());
+    assert(sum_read == sum_map);
+
+    std::cout << "  read<T>():  open " << t_read_open << " s,  sum " << t_read_sum << " s" << std::endl;
+    std::cout << "  map<T>():   open " << t_map_open << " s,  sum " << t_map_sum << " s" << std::endl;
+
+    return 0;
+}
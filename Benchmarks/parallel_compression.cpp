@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare writing and reading a gzip-compressed 2D dataset through
+ * the HDF5 filter pipeline (H5Dwrite/H5Dread) against compressing
+ * chunks on a thread pool and using direct chunk writes and reads,
+ * for 1, 2, 4, ... threads up to the number of hardware threads.
+ *
+ * usage: parallel_compression.exe [rows] [columns] [chunk size] [compression level] [max threads]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int rows = (argc > 1) ? std::atoi(argv[1]) : 4096;
+    const int columns = (argc > 2) ? std::atoi(argv[2]) : 2048;
+    const int chunk_size = (argc > 3) ? std::atoi(argv[3]) : 256;
+    const int compression_level = (argc > 4) ? std::atoi(argv[4]) : 6;
+    const int max_threads = (argc > 5) ? std::atoi(argv[5]) : ThreadPool::default_size();
+    const std::string filename = "bench_parallel_compression.h5";
+
+    // a smooth field rounded to a few digits compresses like typical simulation output
+    std::vector<double> field(static_cast<std::size_t>(rows) * columns);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < columns; ++j) {
+            field[static_cast<std::size_t>(i) * columns + j] =
+                std::round(1000.0 * std::sin(0.01 * i) * std::cos(0.02 * j)) / 1000.0;
+        }
+    }
+    Data<double> data("Field", {rows, columns}, field.data());
+
+    const double megabytes = field.size() * sizeof(double) / 1048576.0;
+    std::cout << "dataset: " << rows << " x " << columns << " doubles (" << megabytes << " MiB), "
+              << chunk_size << " x " << chunk_size << " chunks, gzip level " << compression_level
+              << std::endl;
+
+    auto create_dataset = [&](File& file) {
+        return file.create_dataset("Field", H5T_NATIVE_DOUBLE, {rows, columns},
+                                   {chunk_size, chunk_size}, compression_level);
+    };
+
+    // the HDF5 filter pipeline, compressing each chunk in H5Dwrite
+    {
+        File file(filename, FileMode::trunc);
+        Dataset dataset = create_dataset(file);
+
+        const double t_write = time_seconds([&]() {
+            Dataspace hyperslab = dataset.get_space();
+            hyperslab.select_hyperslab({}, {}, data.dimensions());
+            dataset.write(hyperslab, data);
+        });
+
+        double t_read = time_seconds([&]() {
+            const auto xdata = dataset.read<double>();
+            assert(xdata == field);
+        });
+
+        std::cout << "  H5Dwrite/H5Dread    write: " << megabytes / t_write << " MiB/s"
+                  << "  read: " << megabytes / t_read << " MiB/s" << std::endl;
+    }
+
+    // direct chunk writes and reads with a pool of threads
+    std::vector<int> thread_counts;
+    for (int n = 1; n < max_threads; n *= 2) thread_counts.push_back(n);
+    thread_counts.push_back(max_threads);
+
+    for (int num_threads : thread_counts) {
+        File file(filename, FileMode::trunc);
+        Dataset dataset = create_dataset(file);
+
+        const double t_write = time_seconds([&]() {
+            dataset.write_chunks(data, {}, num_threads);
+        });
+
+        const double t_read = time_seconds([&]() {
+            const auto xdata = dataset.read_chunks<double>({}, {}, num_threads);
+            assert(xdata == field);
+        });
+
+        std::cout << "  direct, " << num_threads << ((num_threads > 1) ? " threads" : " thread ")
+                  << "  write: " << megabytes / t_write << " MiB/s"
+                  << "  read: " << megabytes / t_read << " MiB/s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Weak scaling of parallel appends: every rank appends the same number
+ * of rows in every step, comparing append_collective on a file opened
+ * with MPI-IO on every rank against gathering every segment to rank 0,
+ * which appends them to a file it opens alone.
+ *
+ * run with the same per-rank sizes at increasing rank counts, e.g.
+ *   for n in 1 2 4 8; do mpirun -np $n ./parallel_weak_scaling.exe; done
+ *
+ * usage: parallel_weak_scaling.exe [rows per rank] [columns] [steps]
+ */
+
+#ifdef H5_HAVE_PARALLEL
+
+double elapsed_seconds(std::chrono::steady_clock::time_point start) {
+    // the slowest rank's time since [start]
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double max_seconds = 0.0;
+    MPI_Allreduce(&seconds, &max_seconds, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return max_seconds;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    const int rows = (argc > 1) ? std::atoi(argv[1]) : 16384;
+    const int columns = (argc > 2) ? std::atoi(argv[2]) : 16;
+    const int steps = (argc > 3) ? std::atoi(argv[3]) : 10;
+
+    std::vector<double> segment(static_cast<std::size_t>(rows) * columns, comm_rank);
+    const double megabytes = static_cast<double>(segment.size()) * sizeof(double) *
+                             comm_size * steps / 1048576.0;
+
+    // every rank appends its own segment with collective MPI-IO
+    MPI_Barrier(MPI_COMM_WORLD);
+    auto start = std::chrono::steady_clock::now();
+    {
+        File file("bench_parallel_collective.h5", MPI_COMM_WORLD, FileMode::trunc);
+        Dataset dataset = file.create_dataset("Field", H5T_NATIVE_DOUBLE, {0, columns}, {rows, columns});
+
+        for (int step = 0; step < steps; ++step) {
+            dataset.append_collective(Data<double>("Field", {rows, columns}, segment.data()), MPI_COMM_WORLD);
+        }
+    }
+    const double t_collective = elapsed_seconds(start);
+
+    // every rank sends its segment to rank 0, which appends them all
+    MPI_Barrier(MPI_COMM_WORLD);
+    start = std::chrono::steady_clock::now();
+    {
+        std::vector<double> gathered((comm_rank == 0) ? segment.size() * comm_size : 0);
+
+        File file;
+        Dataset dataset;
+        if (comm_rank == 0) {
+            file = File("bench_parallel_funnel.h5", FileMode::trunc);
+            dataset = file.create_dataset("Field", H5T_NATIVE_DOUBLE, {0, columns}, {rows, columns});
+        }
+
+        for (int step = 0; step < steps; ++step) {
+            MPI_Gather(segment.data(), segment.size(), MPI_DOUBLE,
+                       gathered.data(), segment.size(), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+            if (comm_rank == 0) {
+                dataset.append(Data<double>("Field", {rows * comm_size, columns}, gathered.data()));
+            }
+        }
+    }
+    const double t_funnel = elapsed_seconds(start);
+
+    if (comm_rank == 0) {
+        std::cout << comm_size << " ranks, " << rows << " x " << columns << " doubles per rank per step, "
+                  << steps << " steps (" << megabytes << " MiB)" << std::endl;
+        std::cout << "  append_collective:    " << t_collective << " s  "
+                  << megabytes / t_collective << " MiB/s" << std::endl;
+        std::cout << "  gather to rank 0:     " << t_funnel << " s  "
+                  << megabytes / t_funnel << " MiB/s" << std::endl;
+    }
+
+    MPI_Finalize();
+    return 0;
+}
+
+#else
+
+int main() {
+    std::cout << "skipped: HDF5 was built without parallel support" << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare reading 10^3 to 10^6 random indices of a 1D dataset with
+ * one read per index against a single read_points call, for
+ * isolated indices and for indices clustered into runs of 16.
+ *
+ * usage: random_access.exe [dataset elements] [max indices for the loop]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int elements = (argc > 1) ? std::atoi(argv[1]) : 10000000;
+    const int max_loop_indices = (argc > 2) ? std::atoi(argv[2]) : 10000;
+    const std::string filename = "bench_random_access.h5";
+
+    {
+        std::vector<long long> values(elements);
+        for (int i = 0; i < elements; ++i) values[i] = i;
+
+        File file(filename, FileMode::trunc);
+        file.create_dataset(Data<long long>("Values", values), {65536});
+    }
+
+    File file(filename, FileMode::rw, FileOptions().chunk_cache(64 << 20));
+    Dataset dataset = file.open_dataset("Values");
+
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<int> distribution(0, elements - 16);
+
+    std::cout << "dataset: " << elements << " long longs in chunks of 65536" << std::endl;
+
+    for (int num_indices = 1000; num_indices <= 1000000; num_indices *= 10) {
+        for (int run_length : {1, 16}) {
+            std::vector<int> indices;
+            while (static_cast<int>(indices.size()) < num_indices) {
+                const int start = distribution(generator);
+                for (int k = 0; k < run_length; ++k) indices.push_back(start + k);
+            }
+            indices.resize(num_indices);
+
+            std::cout << "  " << num_indices << " indices in runs of " << run_length << ":" << std::endl;
+
+            if (num_indices <= max_loop_indices) {
+                long long sum = 0;
+                const double t_loop = time_seconds([&]() {
+                    for (const int i : indices) sum += dataset.read<long long>({i}, {1})[0];
+                });
+                std::cout << "    read per index:  " << t_loop << " s" << std::endl;
+            }
+
+            std::vector<long long> points;
+            const double t_points = time_seconds([&]() { points = dataset.read_points<long long>(indices); });
+            for (int i = 0; i < num_indices; ++i) assert(points[i] == indices[i]);
+            std::cout << "    read_points:     " << t_points << " s" << std::endl;
+        }
+    }
+
+    return 0;
+}
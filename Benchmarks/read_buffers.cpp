@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare reading the same slab shape over and over into a new
+ * std::vector each time (read<T>), into one caller-owned buffer
+ * (read into a Span), and into buffers borrowed from the
+ * thread's BufferPool (read_pooled<T>).
+ *
+ * usage: read_buffers.exe [rows] [columns] [slab rows] [repeats]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int rows = (argc > 1) ? std::atoi(argv[1]) : 8192;
+    const int columns = (argc > 2) ? std::atoi(argv[2]) : 256;
+    const int slab_rows = (argc > 3) ? std::atoi(argv[3]) : 1024;
+    const int repeats = (argc > 4) ? std::atoi(argv[4]) : 200;
+    const std::string filename = "bench_read_buffers.h5";
+
+    {
+        std::vector<double> field(static_cast<std::size_t>(rows) * columns);
+        for (std::size_t i = 0; i < field.size(); ++i) field[i] = i;
+
+        File file(filename, FileMode::trunc);
+        file.create_dataset(Data<double>("Field", {rows, columns}, field.data()), {slab_rows, columns});
+    }
+
+    File file(filename);
+    Dataset dataset = file.open_dataset("Field");
+    const int num_slabs = rows / slab_rows;
+
+    std::cout << "reading " << repeats << " slabs of " << slab_rows << " x " << columns
+              << " doubles" << std::endl;
+
+    double sum_vector = 0.0;
+    const double t_vector = time_seconds([&]() {
+        for (int n = 0; n < repeats; ++n) {
+            const auto slab = dataset.read<double>({(n % num_slabs) * slab_rows, 0}, {slab_rows, columns});
+            sum_vector += slab[n % slab.size()];
+        }
+    });
+
+    double sum_span = 0.0;
+    const double t_span = time_seconds([&]() {
+        std::vector<double> slab(static_cast<std::size_t>(slab_rows) * columns);
+        for (int n = 0; n < repeats; ++n) {
+            dataset.read({(n % num_slabs) * slab_rows, 0}, {slab_rows, columns}, Span<double>(slab));
+            sum_span += slab[n % slab.size()];
+        }
+    });
+
+    double sum_pooled = 0.0;
+    const double t_pooled = time_seconds([&]() {
+        for (int n = 0; n < repeats; ++n) {
+            const auto slab = dataset.read_pooled<double>({(n % num_slabs) * slab_rows, 0}, {slab_rows, columns});
+            sum_pooled += slab[n % slab.size()];
+        }
+    });
+
+    assert(sum_vector == sum_span && sum_vector == sum_pooled);
+
+    std::cout << "  new vector per read:  " << t_vector << " s" << std::endl;
+    std::cout << "  caller-owned Span:    " << t_span << " s" << std::endl;
+    std::cout << "  BufferPool:           " << t_pooled << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare Dataset::search, which reads the dataset in chunk-aligned
+ * blocks, against reading and testing one element at a time.
+ *
+ * usage: search.exe [number of elements] [chunk size]
+ */
+
+template<typename T, typename F>
+int search_per_element(Dataset& dataset, F test, bool search_from_end) {
+    // the original search: select and read a single element per test
+    std::vector<int> edims = {1};
+    std::vector<T> element(1);
+    Data<T> delement("element", edims, element.data());
+
+    const int length = dataset.dimensions()[0];
+    const int increment = (search_from_end) ? -1 : 1;
+    const int start = (search_from_end) ? length - 1 : 0;
+
+    for (int offset = start; offset >= 0 && offset < length; offset += increment) {
+        Dataspace hyperslab = dataset.get_space();
+        hyperslab.select_hyperslab({offset}, {}, edims, {});
+        dataset.read(hyperslab, delement);
+        if (test(element[0])) {
+            return offset;
+        }
+    }
+
+    return -1;
+}
+
+void write_benchmark_file(const std::string& filename, int num_elements, int chunk_size) {
+    File file(filename, FileMode::trunc);
+
+    std::vector<double> times(num_elements);
+    for (int i = 0; i < num_elements; ++i) times[i] = 0.1 * i;
+
+    file.create_dataset(Data<double>("Time", times), {chunk_size});
+}
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int num_elements = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+    const int chunk_size = (argc > 2) ? std::atoi(argv[2]) : 4096;
+    const std::string filename = "bench_search.h5";
+
+    write_benchmark_file(filename, num_elements, chunk_size);
+
+    File file(filename);
+    Dataset dataset = file.open_dataset("Time");
+
+    std::cout << "elements: " << num_elements << ", chunk size: " << chunk_size << std::endl;
+
+    // search for a marker at 10%, 50% and 90% of the dataset from either end
+    for (double fraction : {0.1, 0.5, 0.9}) {
+        for (bool from_end : {false, true}) {
+            const int target = static_cast<int>(fraction * num_elements);
+            const double threshold = 0.1 * target - 0.05;
+            auto marker_test = [=](double x) -> bool {
+                return (from_end) ? (x < threshold) : (x > threshold);
+            };
+
+            int loc_blocked = -1;
+            int loc_element = -1;
+
+            const double t_blocked = time_seconds([&]() {
+                loc_blocked = dataset.search<double>(marker_test, from_end);
+            });
+
+            const double t_element = time_seconds([&]() {
+                loc_element = search_per_element<double>(dataset, marker_test, from_end);
+            });
+
+            assert(loc_blocked == loc_element);
+
+            std::cout << "  marker at " << fraction * 100 << "% "
+                      << ((from_end) ? "(backward)" : "(forward) ")
+                      << "  blocked: " << t_blocked << " s"
+                      << "  per-element: " << t_element << " s"
+                      << "  speedup: " << t_element / t_blocked << "x" << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * Compare the two ways a monitor can poll the last rows of a dataset
+ * that a running writer appends to: closing and reopening the file to
+ * read the last N rows, or keeping it open with FileMode::swmr_read and
+ * calling tail, which refreshes the extent and reads only new rows.
+ *
+ * usage: swmr_tail.exe [polls] [rows in the dataset]
+ */
+
+template<typename F>
+double time_seconds(F function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const int num_polls = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    const int num_rows = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+    const std::string filename = "bench_swmr_tail.h5";
+    const int last_n = 100;
+
+    {
+        std::vector<double> values(num_rows);
+        for (int i = 0; i < num_rows; ++i) values[i] = i;
+
+        File file(filename, FileMode::trunc, FileOptions().libver_bounds(H5F_LIBVER_LATEST));
+        auto groups = file.get_nested_groups({"Simulation", "Diagnostics"});
+        groups.back().create_dataset(Data<double>("Energy", values), {4096});
+    }
+
+    std::cout << num_polls << " polls of the last " << last_n << " of " << num_rows << " rows" << std::endl;
+
+    double sum = 0;
+    const double t_reopen = time_seconds([&]() {
+        for (int p = 0; p < num_polls; ++p) {
+            File file(filename);
+            Dataset dataset = file.open_dataset("/Simulation/Diagnostics/Energy");
+            const auto last = dataset.read<double>({-last_n}, {last_n});
+            sum += last.back();
+        }
+    });
+    std::cout << "  reopen and read last N: " << t_reopen << " s" << std::endl;
+
+    File file(filename, FileMode::swmr_read);
+    Dataset dataset = file.open_dataset("/Simulation/Diagnostics/Energy");
+    const double t_tail = time_seconds([&]() {
+        for (int p = 0; p < num_polls; ++p) {
+            const auto rows = dataset.tail<double>(last_n);
+            if (!rows.empty()) sum += rows.back();
+        }
+    });
+    std::cout << "  swmr_read and tail:     " << t_tail << " s" << std::endl;
+
+    assert(sum == static_cast<double>(num_polls + 1) * (num_rows - 1));
+
+    return 0;
+}
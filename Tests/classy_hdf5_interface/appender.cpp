@@ -0,0 +1,114 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file
+ * and append to a 1D "Indices" array and a 2D
+ * "Positions" array through buffered Appenders.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // start the 1D dataset with 3 elements so appends are not chunk-aligned
+    group.create_dataset(Data<int>("Indices", {0, 1, 2}), {5});
+
+    // create an empty 2D dataset with rows of 3 elements
+    group.create_dataset<double>("Positions", {0, 3}, {4, 3});
+}
+
+bool do_append(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    Dataset indices = group.open_dataset("Indices");
+    Dataset positions = group.open_dataset("Positions");
+
+    {
+        Appender<int> index_appender(indices);
+        Appender<double> position_appender(positions);
+
+        // append one element and one row at a time
+        for (int i = 3; i < 40; ++i) {
+            index_appender.append(i);
+
+            std::vector<double> position = {1.0 * i, 2.0 * i, 3.0 * i};
+            position_appender.append(position);
+        }
+
+        // append a vector of elements and a Data object at once
+        std::vector<int> more_indices = {40, 41, 42, 43, 44, 45};
+        index_appender.append(more_indices);
+        index_appender.append(Data<int>("Indices", {46, 47}));
+
+        success = success && (index_appender.size() == 48);
+        success = success && (position_appender.size() == 37);
+
+        // 45 rows are written and the extent has grown geometrically
+        // in whole chunks past them, from 3 to 10, 20, 40 and 80 rows
+        success = success && (indices.dimensions()[0] == 80);
+
+        // after flushing, the extent is trimmed and the dataset
+        // holds exactly the appended data
+        index_appender.flush();
+        success = success && (indices.dimensions()[0] == 48);
+        success = success && (index_appender.size() == 48);
+
+        const std::vector<int> flushed = indices.read<int>();
+        success = success && (flushed.size() == 48);
+        for (std::size_t i = 0; i < flushed.size(); ++i) {
+            success = success && (flushed[i] == static_cast<int>(i));
+        }
+
+        // the position appender is flushed when it goes out of scope
+    }
+
+    success = success && (positions.dimensions()[0] == 37);
+    success = success && (positions.dimensions()[1] == 3);
+
+    return success;
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    std::vector<int> indices = group.read_dataset<int>("Indices");
+    success = success && (indices.size() == 48);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        success = success && (indices[i] == static_cast<int>(i));
+    }
+
+    std::vector<double> positions = group.read_dataset<double>("Positions");
+    success = success && (positions.size() == 37 * 3);
+    for (int i = 0; i < 37; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            success = success && (positions[3 * i + j] == (j + 1.0) * (i + 3));
+        }
+    }
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_appender.h5";
+
+    write_test_file(filename);
+
+    if (do_append(filename) && do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with a 2D
+ * "Field" array and read it into memory we own and into
+ * buffers borrowed from a pool.
+ */
+
+const int rows = 12;
+const int columns = 5;
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // write the field from a pooled buffer, which goes back to the pool with the Data
+    BufferPool<double> pool;
+    PooledBuffer<double> buffer = pool.acquire(rows * columns);
+    for (int i = 0; i < rows * columns; ++i) buffer[i] = 0.5 * i;
+
+    {
+        Data<double> data("Field", {rows, columns}, std::move(buffer));
+        assert(data.owns_data());
+        group.create_dataset(data, {4, columns});
+        assert(pool.num_free() == 0);
+    }
+    assert(pool.num_free() == 1);
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+    Dataset dataset = group.open_dataset("Field");
+
+    bool success = true;
+
+    // read rows 3-6 into a vector we own, through a Span
+    std::vector<double> rows_3_6(4 * columns, -1.0);
+    dataset.read({3, 0}, {4, columns}, Span<double>(rows_3_6));
+    for (int i = 0; i < 4 * columns; ++i) {
+        success = success && (rows_3_6[i] == 0.5 * (3 * columns + i));
+    }
+
+    // read one column into a plain array, which may be larger than the data
+    double column[rows + 2];
+    column[rows] = -1.0;
+    dataset.read({0, 2}, {rows, 1}, column, rows + 2);
+    for (int i = 0; i < rows; ++i) {
+        success = success && (column[i] == 0.5 * (i * columns + 2));
+    }
+    success = success && (column[rows] == -1.0);
+
+    // read the whole dataset into a Span through the group
+    std::vector<double> field(rows * columns);
+    group.read_dataset("Field", Span<double>(field));
+    success = success && (field == dataset.read<double>());
+
+    // pooled reads of the same shape reuse the same storage
+    BufferPool<double> pool;
+    const double* storage = nullptr;
+    for (int n = 0; n < 4; ++n) {
+        PooledBuffer<double> block = dataset.read_pooled<double>({4 * (n % 3), 0}, {4, columns}, pool);
+        success = success && (block.size() == 4 * columns);
+        if (storage) success = success && (block.data() == storage);
+        storage = block.data();
+        for (int i = 0; i < 4 * columns; ++i) {
+            success = success && (block[i] == 0.5 * (4 * (n % 3) * columns + i));
+        }
+    }
+    success = success && (pool.num_free() == 1);
+
+    // a smaller request reuses the larger free storage and a larger one allocates
+    {
+        PooledBuffer<double> small = pool.acquire(3);
+        success = success && (small.data() == storage) && (small.capacity() == 4 * columns);
+        PooledBuffer<double> large = pool.acquire(100);
+        success = success && (large.capacity() == 100) && (pool.num_free() == 0);
+    }
+    success = success && (pool.num_free() == 2);
+
+    // reads default to the pool of the calling thread
+    {
+        PooledBuffer<double> all = dataset.read_pooled<double>();
+        success = success && (std::vector<double>(all.begin(), all.end()) == field);
+    }
+    success = success && (BufferPool<double>::local().num_free() == 1);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_buffer_pool.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file and write
+ * compressed and uncompressed 2D arrays to it chunk by
+ * chunk, compressing the chunks on several threads, with
+ * ClassyHDF built with CLASSY_HDF_ZLIB. Datasets with filters
+ * we cannot apply ourselves are written by the library instead.
+ */
+
+const int rows = 50;
+const int columns = 30;
+
+std::vector<int> make_field() {
+    std::vector<int> field(rows * columns);
+    for (int i = 0; i < rows * columns; ++i) field[i] = i / 7;
+    return field;
+}
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    auto field = make_field();
+    Data<int> data("Field", {rows, columns}, field.data());
+
+    // the 16x8 chunks leave partial chunks at the end of both dimensions
+    const int num_threads = 3;
+    const int compression_level = 4;
+
+    Dataset compressed = group.create_dataset("Compressed", H5T_NATIVE_INT, {rows, columns},
+                                              {16, 8}, compression_level);
+    compressed.write_chunks(data, {}, num_threads);
+
+    Dataset uncompressed = group.create_dataset("Uncompressed", H5T_NATIVE_INT, {rows, columns}, {16, 8});
+    uncompressed.write_chunks(data, {}, num_threads);
+
+    // write only the second row of chunks of a larger dataset
+    Dataset partial = group.create_dataset("Partial", H5T_NATIVE_INT, {48, 8}, {16, 8}, compression_level);
+    std::vector<int> block(16 * 8, 7);
+    partial.write_chunks(Data<int>("Partial", {16, 8}, block.data()), {16, 0}, num_threads);
+
+    // shuffling is not something we do ourselves, so this goes through the library
+    Dataset shuffled = group.create_dataset("Shuffled", H5T_NATIVE_INT, {rows, columns}, {16, 8},
+                                            FilterPipeline().shuffle().deflate(compression_level));
+    shuffled.write_chunks(data, {}, num_threads);
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    const auto field = make_field();
+
+    for (std::string name : {"Compressed", "Uncompressed", "Shuffled"}) {
+        Dataset dataset = group.open_dataset(name);
+
+        // the chunks we wrote directly are read by the HDF5 library as usual
+        const auto xdata = dataset.read<int>();
+        success = success && (xdata == field);
+
+        // and by reading and decompressing chunks ourselves
+        const auto xchunks = dataset.read_chunks<int>({}, {}, 2);
+        success = success && (xchunks == field);
+
+        // read a block that is not aligned with the chunks
+        const auto xblock = dataset.read_chunks<int>({5, 3}, {40, 20}, 4);
+        for (int i = 0; i < 40; ++i) {
+            for (int j = 0; j < 20; ++j) {
+                success = success && (xblock[i * 20 + j] == field[(i + 5) * columns + j + 3]);
+            }
+        }
+
+        // and straight into memory of our own, leaving the rest of it alone
+        std::vector<int> destination(10 * 5 + 1, -1);
+        dataset.read_chunks({20, 10}, {10, 5}, Span<int>(destination), 2);
+        for (int i = 0; i < 10; ++i) {
+            for (int j = 0; j < 5; ++j) {
+                success = success && (destination[i * 5 + j] == field[(i + 20) * columns + j + 10]);
+            }
+        }
+        success = success && (destination.back() == -1);
+    }
+
+    // the shuffled dataset kept its filters
+    success = success && group.open_dataset("Shuffled").filters().has(H5Z_FILTER_SHUFFLE);
+
+    // chunks that were never written read as zeros
+    Dataset partial = group.open_dataset("Partial");
+    const auto xpartial = partial.read_chunks<int>();
+    const auto xpartial_hdf5 = partial.read<int>();
+    success = success && (xpartial == xpartial_hdf5);
+    for (int i = 0; i < 48 * 8; ++i) {
+        success = success && (xpartial[i] == ((i >= 16 * 8 && i < 32 * 8) ? 7 : 0));
+    }
+
+    // even when reading into memory that held something else
+    std::vector<int> reused(48 * 8, -1);
+    partial.read_chunks({}, {}, reused.data(), reused.size());
+    success = success && (reused == xpartial_hdf5);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_chunk_compression.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
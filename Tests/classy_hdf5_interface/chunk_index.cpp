@@ -0,0 +1,219 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with a sorted and an
+ * unsorted dataset, give each a chunk index, and check that searches
+ * with a ValueRange find the same indices as a plain search while
+ * reading only the chunks that may match, using the I/O counts from
+ * ClassyHDF built with CLASSY_HDF_INSTRUMENT. Then we check that
+ * append, write, set_extent, Appenders and remove keep the index up to
+ * date, and that a handle cache shares whether a dataset has an index.
+ */
+
+const int num_values = 10000;
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // times in sorted order, 100 chunks of 100
+    std::vector<double> times(num_values);
+    for (int i = 0; i < num_values; ++i) times[i] = 0.5 * i;
+    group.create_dataset(Data<double>("Time", times), {100});
+
+    // chunk n of 50 holds the values 10n to 10n + 9, out of order
+    std::vector<int> noisy(num_values);
+    for (int i = 0; i < num_values; ++i) noisy[i] = (i / 50) * 10 + (i * 7) % 10;
+    group.create_dataset(Data<int>("Noisy", noisy), {50});
+
+    Dataset time = group.open_dataset("Time");
+    time.create_chunk_index<double>(true);
+
+    Dataset noisy_dataset = group.open_dataset("Noisy");
+    noisy_dataset.create_chunk_index<int>();
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename, FileMode::rw);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    auto reads = [&](const std::string& path) {
+        return file.io_statistics().counts(path, IOOperation::read).calls;
+    };
+
+    // the sorted dataset is binary searched, reading one chunk
+    Dataset time = group.open_dataset("Time");
+    success = success && time.has_chunk_index() && time.chunk_index_sorted();
+
+    std::size_t before = reads("/Data/Time");
+    success = success && (time.search<double>(ValueRange<double>::at_least(2500.0)) == 5000);
+    success = success && (reads("/Data/Time") == before + 1);
+
+    before = reads("/Data/Time");
+    success = success && (time.search<double>(ValueRange<double>::below(2500.0), true) == 4999);
+    success = success && (time.search<double>(ValueRange<double>::between(100.1, 100.4)) == -1);
+    success = success && (reads("/Data/Time") <= before + 2);
+
+    // the same searches without the index
+    success = success && (time.search<double>([](double x) { return x >= 2500.0; }) == 5000);
+    success = success && (time.search<double>([](double x) { return x < 2500.0; }, true) == 4999);
+
+    // the unsorted dataset skips the chunks whose range rules them out
+    Dataset noisy = group.open_dataset("Noisy");
+    success = success && noisy.has_chunk_index() && !noisy.chunk_index_sorted();
+
+    before = reads("/Data/Noisy");
+    success = success && (noisy.search<int>(ValueRange<int>::equal_to(503)) == 2509);
+    success = success && (noisy.search<int>(ValueRange<int>::equal_to(503), true) == 2549);
+    success = success && (noisy.search<int>(ValueRange<int>::above(100000)) == -1);
+    success = success && (reads("/Data/Noisy") == before + 2);
+    success = success && (noisy.search<int>([](int x) { return x == 503; }) == 2509);
+
+    // appending in order keeps the dataset sorted, partial chunks included
+    std::vector<double> later(150);
+    for (int i = 0; i < 150; ++i) later[i] = 0.5 * (num_values + i);
+    time.append(Data<double>("Time", later));
+    success = success && time.chunk_index_sorted();
+    success = success && (ChunkIndex(time.id()).num_rows() == 102);
+
+    before = reads("/Data/Time");
+    success = success && (time.search<double>(ValueRange<double>::at_least(5070.0)) == 10140);
+    success = success && (reads("/Data/Time") == before + 1);
+
+    // appending out of order clears the sorted flag, but the index still finds matches
+    std::vector<double> early = {0.25};
+    time.append(Data<double>("Time", early));
+    success = success && time.has_chunk_index() && !time.chunk_index_sorted();
+    success = success && (time.search<double>(ValueRange<double>::between(0.2, 0.3)) == 10150);
+    success = success && (time.search<double>(ValueRange<double>::at_least(5070.0)) == 10140);
+
+    // writes update the rows of the chunks they touch, reading only those
+    std::vector<int> big = {100000, 100001};
+    before = reads("/Data/Noisy");
+    noisy.write_points({10, 9000}, Data<int>("Noisy", big));
+    success = success && (reads("/Data/Noisy") == before + 2);
+    success = success && (noisy.search<int>(ValueRange<int>::above(99999)) == 10);
+    success = success && (noisy.search<int>(ValueRange<int>::above(99999), true) == 9000);
+
+    // shrinking the dataset drops the rows of the chunks cut off
+    time.set_extent({5050});
+    success = success && (ChunkIndex(time.id()).num_rows() == 51);
+    success = success && (time.search<double>(ValueRange<double>::at_least(5070.0)) == -1);
+
+    // the index can be dropped, and goes with its dataset
+    time.drop_chunk_index();
+    success = success && !time.has_chunk_index() && !group.has_dataset("Time.chunk_index");
+    success = success && (time.search<double>(ValueRange<double>::at_least(2500.0)) == 5000);
+
+    group.remove("Noisy");
+    success = success && !group.has_dataset("Noisy") && !group.has_dataset("Noisy.chunk_index");
+
+    return success;
+}
+
+bool do_resize_test(const std::string& filename) {
+    File file(filename, FileMode::trunc, FileOptions().handle_cache(4));
+
+    bool success = true;
+
+    // 0 to 999 in chunks of 100
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; ++i) values[i] = i;
+    file.create_dataset(Data<int>("Sorted", values), {100});
+
+    Dataset sorted = file.open_dataset("Sorted");
+    sorted.create_chunk_index<int>(true);
+
+    // a dataset opened again through the cache knows it has an index
+    Dataset sorted_again = file.open_dataset("Sorted");
+    success = success && (sorted_again.layout() == sorted.layout());
+    success = success && (sorted_again.layout()->chunk_index == ChunkIndexState::present);
+
+    // truncating into the last chunk re-indexes what is left of it,
+    // so appending the values cut off keeps the dataset sorted
+    sorted.set_extent({950});
+    success = success && (ChunkIndex(sorted.id()).num_rows() == 10);
+    success = success && (sorted.search<int>(ValueRange<int>::at_least(950)) == -1);
+
+    std::vector<int> rest(values.begin() + 950, values.end());
+    sorted.append(Data<int>("Sorted", rest));
+    success = success && sorted.chunk_index_sorted();
+    success = success && (sorted.search<int>(ValueRange<int>::at_least(975)) == 975);
+
+    // an Appender grows the extent ahead of its data, and the unwritten
+    // rows past the data do not end up in the index
+    {
+        Appender<int> appender(sorted);
+        for (int i = 1000; i < 1234; ++i) appender.append(i);
+    }
+    success = success && (sorted.dimensions()[0] == 1234);
+    success = success && (ChunkIndex(sorted.id()).num_rows() == 13);
+    success = success && sorted.chunk_index_sorted();
+    success = success && (sorted.search<int>(ValueRange<int>::at_least(1233)) == 1233);
+    success = success && (sorted.search<int>(ValueRange<int>::at_most(0), true) == 0);
+
+    // dropping the index through one Dataset is seen through the other
+    sorted.drop_chunk_index();
+    success = success && !sorted_again.has_chunk_index();
+
+    return success;
+}
+
+bool do_late_index_test(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+
+    bool success = true;
+
+    // a Dataset that found no index sees the one built later through another
+    std::vector<int> values = {0, 1, 2};
+    file.create_dataset(Data<int>("Late", values), {4});
+
+    Dataset a = file.open_dataset("Late");
+    a.append(Data<int>("Late", {3, 4}));
+    success = success && !a.has_chunk_index();
+
+    Dataset b = file.open_dataset("Late");
+    b.create_chunk_index<int>(true);
+
+    a.append(Data<int>("Late", {100, 101, 102}));
+    success = success && a.has_chunk_index();
+
+    // so the index holds what it appended
+    Dataset c = file.open_dataset("Late");
+    success = success && (c.search<int>(ValueRange<int>::equal_to(100)) == 5);
+    success = success && (c.search<int>([](int x) { return x == 100; }) == 5);
+
+    b.refresh();
+    success = success && (b.search<int>(ValueRange<int>::equal_to(102)) == 7);
+
+    // and an index found unsorted through one is unsorted through the others
+    a.append(Data<int>("Late", {7}));
+    success = success && !b.chunk_index_sorted() && !c.chunk_index_sorted();
+
+    c.refresh();
+    success = success && (c.search<int>(ValueRange<int>::equal_to(7)) == 8);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_chunk_index.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename) && do_resize_test("file_chunk_index_resize.h5") &&
+        do_late_index_test("file_chunk_index_late.h5")) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to check the chunk shapes chosen for
+ * each access pattern, then create datasets in a
+ * "file.h5" HDF5 file with chosen chunk shapes.
+ */
+
+bool test_choose() {
+    bool success = true;
+
+    // with the default 256 KiB target, a chunk holds 32768 doubles
+    const std::size_t dsize = sizeof(double);
+
+    // appended datasets grow along the first dimension
+    success = success && (ChunkPolicy(AccessPattern::append).choose({0}, dsize) == Shape({32768}));
+    success = success && (ChunkPolicy(AccessPattern::append).choose({0, 3}, dsize) == Shape({10922, 3}));
+    success = success && (ChunkPolicy(AccessPattern::append).choose({10, 3}, dsize) == Shape({10922, 3}));
+
+    // row reads keep whole rows, column reads keep whole columns
+    success = success && (ChunkPolicy(AccessPattern::rows).choose({1000, 500}, dsize) == Shape({65, 500}));
+    success = success && (ChunkPolicy(AccessPattern::columns).choose({1000, 500}, dsize) == Shape({1000, 32}));
+
+    // tiles shrink the longest dimension first
+    success = success && (ChunkPolicy(AccessPattern::tiles).choose({1000, 500}, dsize) == Shape({125, 250}));
+
+    // small datasets are limited by their extent
+    success = success && (ChunkPolicy(AccessPattern::rows).choose({10, 20}, dsize) == Shape({10, 20}));
+    success = success && (ChunkPolicy(AccessPattern::tiles).choose({10, 20}, dsize) == Shape({10, 20}));
+
+    // the target size sets the chunk size
+    success = success && (ChunkPolicy(AccessPattern::append, 4096).choose({0}, sizeof(int)) == Shape({1024}));
+
+    return success;
+}
+
+bool test_create(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // create an empty dataset for appending and check the chosen chunk shape
+    Dataset series = group.create_dataset<double>("Series", {}, ChunkPolicy(AccessPattern::append));
+    success = success && (series.chunk_dimensions() == Shape({32768}));
+
+    series.append(Data<double>("Series", {1.0, 2.0, 3.0}));
+    success = success && (series.dimensions()[0] == 3);
+
+    // create a dataset from data with chunks for reading rows
+    std::vector<int> field(100 * 40);
+    for (int i = 0; i < 100 * 40; ++i) field[i] = i;
+
+    Dataset fdataset = group.create_dataset(Data<int>("Field", {100, 40}, field.data()),
+                                            ChunkPolicy(AccessPattern::rows, 4096));
+    success = success && (fdataset.chunk_dimensions() == Shape({25, 40}));
+
+    const auto row = fdataset.read<int>({50, 0}, {1, 40});
+    for (int j = 0; j < 40; ++j) {
+        success = success && (row[j] == 50 * 40 + j);
+    }
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_chunk_policy.h5";
+
+    if (test_choose() && test_create(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file
+ * with a 1D "Steps" array and a 2D "Grid" array
+ * and stream through them block by block.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // a 1D dataset spanning many chunks, with a partial last chunk
+    std::vector<int> steps(1003);
+    for (int i = 0; i < 1003; ++i) steps[i] = i;
+    group.create_dataset(Data<int>("Steps", steps), {64});
+
+    // a 6x8 2D dataset, chunked 4x3, holding its flattened index
+    std::vector<double> grid(6 * 8);
+    for (int i = 0; i < 6 * 8; ++i) grid[i] = i;
+    group.create_dataset(Data<double>("Grid", {6, 8}, grid.data()), {4, 3});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // stream the 1D dataset in blocks of one chunk, prefetching 3 blocks
+    Dataset steps = group.open_dataset("Steps");
+    {
+        ChunkStream<int> stream(steps, 0, 3, 64);
+        success = success && (stream.num_blocks() == 16);
+
+        int expected = 0;
+        for (const auto& block : stream) {
+            success = success && (block.offset == expected);
+            success = success && (block.length == ((expected < 960) ? 64 : 43));
+            for (std::size_t i = 0; i < block.size; ++i) {
+                success = success && (block.data[i] == expected++);
+            }
+        }
+        success = success && (expected == 1003);
+    }
+
+    // with the default block length, small chunks are grouped into one block
+    {
+        ChunkStream<int> stream(steps);
+        success = success && (stream.num_blocks() == 1);
+    }
+
+    // stop reading early, leaving prefetched blocks unused
+    {
+        ChunkStream<int> stream(steps, 0, 2, 100);
+        const auto* block = stream.next();
+        success = success && (block->offset == 0) && (block->data[99] == 99);
+        block = stream.next();
+        success = success && (block->offset == 100) && (block->data[0] == 100);
+    }
+
+    // stream the 2D dataset along its second axis one chunk at a time:
+    // blocks of 3, 3 and 2 columns spanning every row
+    Dataset grid = group.open_dataset("Grid");
+    {
+        ChunkStream<double> stream(grid, 1, 1, 3);
+        int column = 0;
+        while (const auto* block = stream.next()) {
+            success = success && (block->offset == column);
+            success = success && (block->dimensions == Shape({6, block->length}));
+            for (int i = 0; i < 6; ++i) {
+                for (int j = 0; j < block->length; ++j) {
+                    success = success && (block->data[i * block->length + j] == i * 8 + column + j);
+                }
+            }
+            column += block->length;
+        }
+        success = success && (column == 8);
+    }
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_chunk_stream.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
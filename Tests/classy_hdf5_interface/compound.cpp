@@ -0,0 +1,157 @@
+#include <array>
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with a
+ * 1D "Particles" array of compound records and datasets
+ * of the newly mapped scalar types, then read them back.
+ */
+
+struct Particle {
+    long long id;
+    double position[3];
+    std::array<float, 3> velocity;
+    unsigned int flags;
+    bool active;
+};
+CLASSY_HDF_COMPOUND(Particle, id, position, velocity, flags, active)
+
+// the position and id of a Particle, in a different order
+struct ParticlePosition {
+    double position[3];
+    long long id;
+};
+CLASSY_HDF_COMPOUND(ParticlePosition, position, id)
+
+Particle make_particle(int i) {
+    Particle p;
+    p.id = 10000000000LL + i;
+    for (int k = 0; k < 3; ++k) {
+        p.position[k] = i + 0.1 * k;
+        p.velocity[k] = -i - 0.5f * k;
+    }
+    p.flags = 4000000000u - i;
+    p.active = (i % 3 == 0);
+    return p;
+}
+
+bool same_particle(const Particle& a, const Particle& b) {
+    bool same = (a.id == b.id) && (a.flags == b.flags) && (a.active == b.active);
+    for (int k = 0; k < 3; ++k) {
+        same = same && (a.position[k] == b.position[k]) && (a.velocity[k] == b.velocity[k]);
+    }
+    return same;
+}
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // write the first 50 particles at once
+    std::vector<Particle> particles;
+    for (int i = 0; i < 50; ++i) particles.push_back(make_particle(i));
+    Dataset dataset = group.create_dataset(Data<Particle>("Particles", particles), {16});
+
+    // append 20 more, each record in a single write
+    for (int i = 50; i < 60; ++i) {
+        std::vector<Particle> one = {make_particle(i)};
+        dataset.append(Data<Particle>("Particles", one));
+    }
+    {
+        Appender<Particle> appender(dataset);
+        for (int i = 60; i < 70; ++i) appender.append(make_particle(i));
+    }
+
+    // the new scalar mappings
+    std::vector<unsigned long long> big = {0, 1, 18446744073709551615ULL};
+    group.create_dataset(Data<unsigned long long>("UInt64", big), {4});
+
+    std::vector<bool> bits = {true, false, true};
+    bool flags[3] = {bits[0], bits[1], bits[2]};
+    group.create_dataset(Data<bool>("Bool", {3}, flags), {4});
+
+    std::vector<unsigned char> bytes = {0, 128, 255};
+    group.create_dataset(Data<unsigned char>("UInt8", bytes), {4});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // the type is built once and reused
+    success = success && (CppTypeToHDF<Particle>() == CppTypeToHDF<Particle>());
+
+    Dataset dataset = group.open_dataset("Particles");
+    success = success && (dataset.type_class() == H5T_COMPOUND);
+    success = success && (dataset.dimensions() == Shape({70}));
+
+    // read whole records
+    const auto particles = dataset.read<Particle>();
+    for (int i = 0; i < 70; ++i) {
+        success = success && same_particle(particles[i], make_particle(i));
+    }
+
+    // and a slice of them
+    const auto slice = dataset.read<Particle>({45}, {10});
+    for (int i = 0; i < 10; ++i) {
+        success = success && same_particle(slice[i], make_particle(45 + i));
+    }
+
+    // search the records
+    const int first_inactive = dataset.search<Particle>([](const Particle& p) { return !p.active; });
+    success = success && (first_inactive == 1);
+    const int last_id = dataset.search<Particle>([](const Particle& p) { return p.id < 10000000060LL; }, true);
+    success = success && (last_id == 59);
+
+    // read single members
+    const auto ids = group.open_dataset("Particles").read_field<long long>("id", {5}, {3});
+    success = success && (ids == std::vector<long long>({10000000005LL, 10000000006LL, 10000000007LL}));
+
+    const auto velocities = dataset.read_field<std::array<float, 3>>("velocity");
+    success = success && (velocities.size() == 70) && (velocities[69][2] == -70.0f);
+
+    const auto active = dataset.read_field<bool>("active");
+    for (int i = 0; i < 70; ++i) {
+        success = success && (active[i] == (i % 3 == 0));
+    }
+
+    // read a subset of members into another struct
+    const auto positions = dataset.read_fields<ParticlePosition>({60}, {10});
+    for (int i = 0; i < 10; ++i) {
+        success = success && (positions[i].id == 10000000060LL + i);
+        success = success && (positions[i].position[2] == 60 + i + 0.2);
+    }
+
+    // the new scalar mappings
+    const auto big = group.read_dataset<unsigned long long>("UInt64");
+    success = success && (big == std::vector<unsigned long long>({0, 1, 18446744073709551615ULL}));
+
+    const auto bits = group.read_dataset<bool>("Bool");
+    success = success && (bits == std::vector<bool>({true, false, true}));
+
+    const auto bytes = group.read_dataset<unsigned char>("UInt8");
+    success = success && (bytes == std::vector<unsigned char>({0, 128, 255}));
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_compound.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file
+ * with tuned file and dataset access options
+ * and work with a 2D "Field" array in it, then check that
+ * opening a file with options that do not fit it leaves it alone.
+ */
+
+FileOptions tuned_options() {
+    return FileOptions().chunk_cache(16 << 20, 1009, 0.5)
+                        .metadata_cache(4 << 20, 1 << 20, 32 << 20)
+                        .alignment(4096, 4096)
+                        .page_buffer(4096, 1 << 20)
+                        .libver_bounds(H5F_LIBVER_LATEST);
+}
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc, tuned_options());
+    Group group = file.get_group("Data");
+
+    std::vector<double> field(64 * 32);
+    for (int i = 0; i < 64 * 32; ++i) field[i] = i;
+    group.create_dataset(Data<double>("Field", {64, 32}, field.data()), {16, 16});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename, FileMode::rw, tuned_options());
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // the file access options are in effect
+    hid_t file_access = H5Fget_access_plist(file.id());
+    hsize_t threshold, alignment;
+    H5Pget_alignment(file_access, &threshold, &alignment);
+    success = success && (threshold == 4096) && (alignment == 4096);
+
+    int mdc_elements;
+    std::size_t slots, bytes;
+    double w0;
+    H5Pget_cache(file_access, &mdc_elements, &slots, &bytes, &w0);
+    success = success && (slots == 1009) && (bytes == (16 << 20)) && (w0 == 0.5);
+    H5Pclose(file_access);
+
+    // open the dataset with its own chunk cache
+    Dataset dataset = group.open_dataset("Field", DatasetAccessOptions().chunk_cache(1 << 20, 101));
+
+    hid_t dataset_access = H5Dget_access_plist(dataset.id());
+    H5Pget_chunk_cache(dataset_access, &slots, &bytes, &w0);
+    success = success && (slots == 101) && (bytes == (1 << 20));
+    H5Pclose(dataset_access);
+
+    // read a column of the dataset
+    const auto column = dataset.read<double>({0, 5}, {64, 1});
+    for (int i = 0; i < 64; ++i) {
+        success = success && (column[i] == i * 32 + 5);
+    }
+
+    return success;
+}
+
+bool do_mismatch_test(const std::string& filename) {
+    // a page buffer needs a file created with paged aggregation, so
+    // opening a plain file with one fails, and must not truncate it
+    {
+        File plain(filename, FileMode::trunc);
+        std::vector<int> values = {1, 2, 3};
+        plain.create_dataset(Data<int>("Values", values), {3});
+    }
+
+    bool success = true;
+    {
+        File paged(filename, FileMode::rw, FileOptions().page_buffer(4096, 1 << 20));
+        success = success && !paged.initialized() && (paged.id() < 0);
+    }
+
+    File plain(filename);
+    success = success && (plain.read_dataset<int>("Values") == std::vector<int>({1, 2, 3}));
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_file_options.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename) && do_mismatch_test("file_file_options_plain.h5")) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
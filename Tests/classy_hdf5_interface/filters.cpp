@@ -0,0 +1,132 @@
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with datasets written
+ * through several filter pipelines, then check that each dataset
+ * reports the pipeline it was created with and reads back its data.
+ */
+
+const int num_values = 1000;
+
+std::vector<double> make_field() {
+    std::vector<double> field(num_values);
+    for (int i = 0; i < num_values; ++i) field[i] = std::sin(0.01 * i) + 0.001 * i;
+    return field;
+}
+
+std::vector<int> make_counts() {
+    std::vector<int> counts(num_values);
+    for (int i = 0; i < num_values; ++i) counts[i] = 100000 + i / 7;
+    return counts;
+}
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    auto field = make_field();
+    auto counts = make_counts();
+
+    // a gzip level still makes a deflate pipeline, and level 0 no filters at all
+    group.create_dataset(Data<double>("Gzip", field), {100}, 4);
+    group.create_dataset(Data<double>("Plain", field), {100}, 0);
+
+    // several filters with parameters, checksummed last
+    group.create_dataset(Data<double>("Shuffled", field), {100},
+                         FilterPipeline().shuffle().deflate(1).fletcher32());
+
+    // lossless scale-offset for integers, lossy to 3 decimal digits for floats
+    group.create_dataset(Data<int>("Counts", counts), {100},
+                         FilterPipeline().scale_offset(H5Z_SO_INT, H5Z_SO_INT_MINBITS_DEFAULT).deflate(1));
+    group.create_dataset(Data<double>("Scaled", field), {100},
+                         FilterPipeline().scale_offset(H5Z_SO_FLOAT_DSCALE, 3));
+
+    // optional plugin filters are skipped where they are not installed
+    group.create_dataset(Data<double>("Plugins", field), {100},
+                         FilterPipeline().lz4().zstd(5).shuffle());
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    const auto field = make_field();
+    const auto counts = make_counts();
+
+    bool success = true;
+
+    Dataset gzip = group.open_dataset("Gzip");
+    const FilterPipeline gzip_filters = gzip.filters();
+    success = success && (gzip_filters.ids() == std::vector<H5Z_filter_t>({H5Z_FILTER_DEFLATE}));
+    success = success && (gzip_filters.filters()[0].parameters == std::vector<unsigned int>({4}));
+    success = success && (gzip.read<double>() == field);
+
+    // and is the same pipeline H5Pset_deflate makes, with deflate optional
+    hid_t deflate_parameters = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_deflate(deflate_parameters, 4);
+    const FilterPipeline deflate_filters = FilterPipeline::from_plist(deflate_parameters);
+    H5Pclose(deflate_parameters);
+    success = success && gzip_filters.filters()[0].optional && deflate_filters.filters()[0].optional;
+    success = success && (gzip_filters.filters()[0].parameters == deflate_filters.filters()[0].parameters);
+
+    Dataset plain = group.open_dataset("Plain");
+    success = success && plain.filters().empty();
+
+    Dataset shuffled = group.open_dataset("Shuffled");
+    const auto shuffled_ids = std::vector<H5Z_filter_t>({H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE, H5Z_FILTER_FLETCHER32});
+    success = success && (shuffled.filters().ids() == shuffled_ids);
+    success = success && (shuffled.filters().filters()[0].name.size() > 0);
+    success = success && shuffled.filters().filters()[0].optional && !shuffled.filters().filters()[2].optional;
+    success = success && (shuffled.read<double>() == field);
+
+    Dataset counts_dataset = group.open_dataset("Counts");
+    success = success && counts_dataset.filters().has(H5Z_FILTER_SCALEOFFSET);
+    success = success && (counts_dataset.read<int>() == counts);
+
+    Dataset scaled = group.open_dataset("Scaled");
+    const auto scaled_field = scaled.read<double>();
+    success = success && (scaled_field.size() == field.size());
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        success = success && (std::abs(scaled_field[i] - field[i]) <= 1.0e-3);
+    }
+
+    // the plugins are recorded either way, and shuffle always applies
+    Dataset plugins = group.open_dataset("Plugins");
+    const FilterPipeline plugin_filters = plugins.filters();
+    success = success && (plugin_filters.ids() ==
+                          std::vector<H5Z_filter_t>({FilterID::lz4, FilterID::zstd, H5Z_FILTER_SHUFFLE}));
+    success = success && plugin_filters.filters()[0].optional;
+    success = success && (plugins.read<double>() == field);
+
+    success = success && FilterPipeline::available(H5Z_FILTER_DEFLATE);
+
+    // bitshuffle takes the block size and compression, and fills in the rest itself
+    const Filter bitshuffle = FilterPipeline().bitshuffle(true, 1024).filters()[0];
+    success = success && (bitshuffle.parameters == std::vector<unsigned int>({1024, 2}));
+
+    // a gzip level only becomes a pipeline when asked to
+    success = success && !std::is_convertible<int, FilterPipeline>::value;
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_filters.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,116 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with a few datasets
+ * in nested groups, then open them repeatedly by name through a
+ * file with a small handle cache and check the cache counters,
+ * that removed objects leave the cache, and that nothing is left
+ * open once the file is closed.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    auto groups = file.get_nested_groups({"Run", "Step"});
+
+    for (const std::string name : {"A", "B", "C"}) {
+        std::vector<int> values = {1, 2, 3};
+        groups.back().create_dataset(Data<int>(name, values), {8});
+    }
+}
+
+bool do_test(const std::string& filename) {
+    bool success = true;
+
+    {
+        File file(filename, FileMode::rw, FileOptions().handle_cache(2));
+        auto cache = file.handle_cache();
+        success = success && cache && (cache->capacity() == 2);
+
+        // the nested groups each know their full path
+        auto groups = file.get_nested_groups({"Run", "Step"});
+        Group& step = groups.back();
+        success = success && (groups[0].path() == "/Run") && (step.path() == "/Run/Step");
+        success = success && (step.child_path("A") == "/Run/Step/A");
+        success = success && (cache->misses() == 2) && (cache->hits() == 0);
+
+        // opening a group again is a hit
+        Group run = file.get_group("Run");
+        success = success && (cache->hits() == 1);
+
+        // the two groups fill the cache, so each new dataset evicts one
+        success = success && (step.read_dataset<int>("A") == std::vector<int>({1, 2, 3}));
+        success = success && (cache->misses() == 3) && (cache->evictions() == 1);
+
+        // reopening A is a hit, and appending through a cached handle works
+        std::vector<int> more = {4, 5};
+        step.append(Data<int>("A", more));
+        success = success && (cache->hits() == 2);
+        success = success && (step.read_dataset<int>("A") == std::vector<int>({1, 2, 3, 4, 5}));
+        success = success && (cache->hits() == 3);
+
+        // a hit reuses the layout looked up on the first open, and sees the current extent
+        Dataset a = step.open_dataset("A");
+        Dataset a_again = file.open_dataset("/Run/Step/A");
+        success = success && a.layout() && (a.layout() == a_again.layout());
+        success = success && (cache->layout("/Run/Step/A") == a.layout());
+        success = success && (a_again.dimensions()[0] == 5) && (a_again.chunk_dimensions()[0] == 8);
+        success = success && (cache->hits() == 5);
+
+        // has_dataset only probes: absolute paths share entries with relative ones,
+        // and neither a cached nor an uncached dataset is counted or added
+        success = success && file.has_dataset("/Run/Step/A");
+        success = success && step.has_dataset("C");
+        success = success && (cache->hits() == 5) && (cache->misses() == 3);
+        success = success && !cache->contains("/Run/Step/C", H5I_DATASET);
+
+        // a missing dataset is neither cached nor counted
+        success = success && !step.has_dataset("Missing");
+        success = success && (cache->size() == 2) && (cache->misses() == 3);
+
+        // removing a dataset drops it from the cache so we can make a new one
+        step.remove("A");
+        success = success && !step.has_dataset("A");
+        std::vector<double> replacement = {0.5};
+        step.create_dataset(Data<double>("A", replacement), {8});
+        success = success && (step.read_dataset<double>("A") == replacement);
+
+        // removing a group drops everything under it
+        step.read_dataset<int>("B");
+        file.remove("Run");
+        success = success && (cache->size() == 0);
+        success = success && !file.has_dataset("/Run/Step/B");
+    }
+
+    // the file and every object the cache held are closed
+    success = success && (H5Fget_obj_count(H5F_OBJ_ALL, H5F_OBJ_ALL) == 0);
+
+    {
+        // without a cache, nothing changes
+        File file(filename);
+        success = success && !file.handle_cache();
+        success = success && (file.get_group("Run").path() == "/Run");
+    }
+
+    success = success && (H5Fget_obj_count(H5F_OBJ_ALL, H5F_OBJ_ALL) == 0);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_handle_cache.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
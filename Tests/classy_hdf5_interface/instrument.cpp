@@ -0,0 +1,122 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with ClassyHDF built
+ * with CLASSY_HDF_INSTRUMENT, work with a couple of datasets, and
+ * check the I/O counts collected for the file and the JSON report
+ * written when it is closed, also for datasets kept open by a handle cache.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    std::vector<int> xdata(100);
+    for (int i = 0; i < 100; ++i) xdata[i] = i;
+    group.create_dataset(Data<int>("Indices", xdata), {10});
+}
+
+bool do_test(const std::string& filename) {
+    bool success = true;
+    const std::string report_filename = "file_instrument.json";
+
+    {
+        File file(filename, FileMode::rw, FileOptions().io_report(report_filename, IOReportFormat::json));
+        Group group = file.get_group("Data");
+
+        // opening the file is counted against its root
+        FileIOStatistics statistics = file.io_statistics();
+        success = success && (statistics.counts("/", IOOperation::open).calls == 1);
+        success = success && (statistics.totals(IOOperation::create).calls == 0);
+
+        Dataset indices = group.open_dataset("Indices");
+        std::vector<int> more = {100, 101, 102};
+        indices.append(Data<int>("Indices", more));
+        const auto last = indices.read<int>({-5}, {5});
+        const auto all = indices.read<int>();
+        success = success && (last == std::vector<int>({98, 99, 100, 101, 102})) && (all.size() == 103);
+
+        std::vector<double> values = {0.5, 1.5};
+        group.create_dataset(Data<double>("Values", values), {8});
+
+        statistics = file.io_statistics();
+        const IOCounts open = statistics.counts("/Data/Indices", IOOperation::open);
+        const IOCounts extend = statistics.counts("/Data/Indices", IOOperation::set_extent);
+        const IOCounts write = statistics.counts("/Data/Indices", IOOperation::write);
+        const IOCounts read = statistics.counts("/Data/Indices", IOOperation::read);
+        success = success && (open.calls == 1) && (extend.calls == 1);
+        success = success && (write.calls == 1) && (write.elements == 3) && (write.bytes == 3 * sizeof(int));
+        success = success && (read.calls == 2) && (read.elements == 108) && (read.bytes == 108 * sizeof(int));
+        success = success && (read.seconds > 0.0);
+
+        success = success && (statistics.counts("/Data/Values", IOOperation::create).calls == 1);
+        success = success && (statistics.totals(IOOperation::write).calls == 2);
+        success = success && (statistics.paths() == std::vector<std::string>({"/", "/Data/Indices", "/Data/Values"}));
+
+        // a summary lists every object
+        std::ostringstream summary;
+        statistics.write_summary(summary, filename);
+        success = success && (summary.str().find("/Data/Values") != std::string::npos);
+    }
+
+    // the counts were written to the report and forgotten when the file closed
+    std::ifstream report_file(report_filename);
+    std::stringstream report;
+    report << report_file.rdbuf();
+    const std::string json = report.str();
+    success = success && (json.find("\"file\": \"" + filename + "\"") == 1);
+    success = success && (json.find("\"/Data/Indices\": {\"open\": {\"calls\": 1") != std::string::npos);
+    success = success && (json.find("\"read\": {\"calls\": 2, \"elements\": 108") != std::string::npos);
+    success = success && IOStatistics::global().file(filename).empty();
+
+    return success;
+}
+
+bool do_cache_test(const std::string& filename) {
+    bool success = true;
+
+    File file(filename, FileMode::rw, FileOptions().handle_cache(4));
+    Group group = file.get_group("Data");
+
+    // each append opens and closes a Dataset, but the cache keeps the
+    // dataset open, so all the counts go to the same object
+    for (int i = 0; i < 3; ++i) {
+        group.append(Data<int>("Indices", std::vector<int>({i})));
+    }
+
+    FileIOStatistics statistics = file.io_statistics();
+    success = success && (statistics.counts("/Data/Indices", IOOperation::open).calls == 3);
+    success = success && (statistics.counts("/Data/Indices", IOOperation::write).calls == 3);
+    success = success && (statistics.counts("/Data/Indices", IOOperation::write).elements == 3);
+
+    // counts made after the last look are added to the earlier ones, also
+    // once the cache has closed the dataset
+    group.append(Data<int>("Indices", std::vector<int>({3})));
+    file.handle_cache()->clear();
+    statistics = file.io_statistics();
+    success = success && (statistics.counts("/Data/Indices", IOOperation::write).calls == 4);
+    success = success && (statistics.counts("/Data/Indices", IOOperation::set_extent).calls == 4);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_instrument.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename) && do_cache_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
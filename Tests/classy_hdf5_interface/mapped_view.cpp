@@ -0,0 +1,94 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with contiguous
+ * and chunked 2D arrays and map them into memory.
+ */
+
+const int rows = 300;
+const int columns = 7;
+
+std::vector<double> make_field() {
+    std::vector<double> field(rows * columns);
+    for (int i = 0; i < rows * columns; ++i) field[i] = 0.25 * i;
+    return field;
+}
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    auto field = make_field();
+
+    // without chunk dimensions the dataset is stored contiguously
+    group.create_dataset(Data<double>("Contiguous", {rows, columns}, field.data()), {});
+
+    group.create_dataset(Data<double>("Chunked", {rows, columns}, field.data()), {64, columns});
+
+    // a contiguous dataset we never write has no storage in the file yet
+    group.create_dataset("Unwritten", H5T_NATIVE_INT, {10}, {});
+}
+
+bool do_test(const std::string& filename) {
+    bool success = true;
+
+    const auto field = make_field();
+
+    MappedView<double> kept_view;
+    {
+        File file(filename);
+        Group group = file.get_group("Data");
+
+        // the contiguous dataset is mapped from the file
+        Dataset contiguous = group.open_dataset("Contiguous");
+        success = success && contiguous.chunk_dimensions().empty();
+        success = success && (contiguous.max_dimensions() == Shape({rows, columns}));
+
+        for (auto access : {MapAccess::normal, MapAccess::sequential, MapAccess::random, MapAccess::willneed}) {
+            const auto view = contiguous.map<double>(access);
+            success = success && view.mapped();
+            success = success && (view.dimensions() == Shape({rows, columns}));
+            success = success && (std::vector<double>(view.begin(), view.end()) == field);
+        }
+
+        // the chunked dataset falls back to a copy read with H5Dread
+        Dataset chunked = group.open_dataset("Chunked");
+        const auto chunked_view = chunked.map<double>(MapAccess::sequential);
+        success = success && !chunked_view.mapped();
+        success = success && (chunked_view.size() == field.size());
+        success = success && (std::vector<double>(chunked_view.begin(), chunked_view.end()) == field);
+
+        // so does a dataset without storage, which reads as its fill value
+        Dataset unwritten = group.open_dataset("Unwritten");
+        const auto unwritten_view = unwritten.map<int>();
+        success = success && !unwritten_view.mapped();
+        success = success && (std::vector<int>(unwritten_view.begin(), unwritten_view.end()) == std::vector<int>(10, 0));
+
+        kept_view = contiguous.map<double>();
+    }
+
+    // a mapping stays valid after the file is closed
+    success = success && kept_view.mapped();
+    success = success && (kept_view[rows * columns - 1] == field.back());
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_mapped_view.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,113 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file from every rank
+ * of an MPI job and have each rank write its own part of a
+ * fixed-size array and append its own rows to a growing one.
+ *
+ * build with "make test_parallel" against a parallel HDF5
+ * and run with e.g. "mpirun -np 4 ./parallel_append.exe"
+ */
+
+#ifdef H5_HAVE_PARALLEL
+
+const int columns = 3;
+const int rounds = 3;
+
+int segment_rows(int comm_rank) {
+    // every other rank appends nothing, to exercise empty segments
+    return (comm_rank % 2 == 1) ? 0 : comm_rank + 1;
+}
+
+void write_test_file(const std::string& filename, int comm_rank, int comm_size) {
+    File file(filename, MPI_COMM_WORLD, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // each rank writes 4 elements of a fixed-size dataset
+    Dataset ranks = group.create_dataset("Ranks", H5T_NATIVE_INT, {4 * comm_size}, {4});
+    std::vector<int> values(4, comm_rank);
+    Data<int> data("Ranks", values);
+
+    Dataspace hyperslab = ranks.get_space();
+    hyperslab.select_contiguous({4 * comm_rank}, {4});
+    ranks.write(hyperslab, data);
+
+    // each rank appends its rows, holding the rank and round, in every round
+    Dataset steps = group.create_dataset("Steps", H5T_NATIVE_INT, {0, columns}, {16, columns});
+    for (int round = 0; round < rounds; ++round) {
+        const int rows = segment_rows(comm_rank);
+        std::vector<int> segment(rows * columns, 100 * round + comm_rank);
+        steps.append_collective(Data<int>("Steps", {rows, columns}, segment.data()), MPI_COMM_WORLD);
+    }
+}
+
+bool do_test(const std::string& filename, int comm_size) {
+    File file(filename, MPI_COMM_WORLD);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    Dataset ranks = group.open_dataset("Ranks");
+    success = success && ranks.collective();
+    const auto xranks = ranks.read<int>();
+    for (int i = 0; i < 4 * comm_size; ++i) {
+        success = success && (xranks[i] == i / 4);
+    }
+
+    // the segments are in rank order within each round
+    Dataset steps = group.open_dataset("Steps");
+    const auto xsteps = steps.read<int>();
+
+    int row = 0;
+    for (int round = 0; round < rounds; ++round) {
+        for (int r = 0; r < comm_size; ++r) {
+            for (int i = 0; i < segment_rows(r); ++i, ++row) {
+                for (int j = 0; j < columns; ++j) {
+                    success = success && (xsteps[row * columns + j] == 100 * round + r);
+                }
+            }
+        }
+    }
+    success = success && (steps.dimensions() == Shape({row, columns}));
+
+    // every rank has to succeed
+    int local_success = success;
+    int all_success = 0;
+    MPI_Allreduce(&local_success, &all_success, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+
+    return all_success;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    const std::string filename = "file_parallel_append.h5";
+
+    write_test_file(filename, comm_rank, comm_size);
+
+    const bool success = do_test(filename, comm_size);
+
+    if (comm_rank == 0) std::cout << (success ? "success" : "failure") << std::endl;
+
+    MPI_Finalize();
+    return success ? 0 : -1;
+}
+
+#else
+
+int main() {
+    std::cout << "skipped: HDF5 was built without parallel support" << std::endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with 1D and 2D
+ * arrays and read and write scattered entries and several
+ * disjoint slabs of them, each with a single call.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // a 1D dataset holding its index
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; ++i) values[i] = i;
+    group.create_dataset(Data<int>("Values", values), {64});
+
+    // a 2D dataset holding 10 * row + column
+    std::vector<double> grid(100 * 4);
+    for (int i = 0; i < 100; ++i) {
+        for (int j = 0; j < 4; ++j) grid[i * 4 + j] = 10 * i + j;
+    }
+    group.create_dataset(Data<double>("Grid", {100, 4}, grid.data()), {16, 4});
+
+    // a 1D dataset we fill with scattered writes
+    group.create_dataset<int>("Scattered", {20}, {8});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // scattered points in any order, with repeats
+    Dataset values = group.open_dataset("Values");
+    const std::vector<int> indices = {999, 3, 500, 3, 0, 501, 502, 77};
+    const auto points = values.read_points<int>(indices);
+    success = success && (points == indices);
+
+    // sorted points, which are read straight into the result
+    const std::vector<int> sorted = {1, 2, 3, 10, 20, 30, 31};
+    success = success && (values.read_points<int>(sorted) == sorted);
+    success = success && values.read_points<int>({}).empty();
+
+    // rows of a 2D dataset
+    Dataset grid = group.open_dataset("Grid");
+    const auto rows = grid.read_points<double>({42, 7, 8});
+    const std::vector<double> expected_rows = {420, 421, 422, 423, 70, 71, 72, 73, 80, 81, 82, 83};
+    success = success && (rows == expected_rows);
+
+    // the union of several slabs, packed in order
+    const auto windows = values.read_slabs<int>({{{10}, {3}}, {{100}, {2}}, {{990}, {4}}});
+    success = success && (windows == std::vector<int>({10, 11, 12, 100, 101, 990, 991, 992, 993}));
+
+    const auto blocks = grid.read_slabs<double>({{{1, 1}, {2, 2}}, {{50, 0}, {1, 3}}});
+    success = success && (blocks == std::vector<double>({11, 12, 21, 22, 500, 501, 502}));
+
+    // scatter writes in any order, and to slabs
+    Dataset scattered = group.open_dataset("Scattered");
+    std::vector<int> point_values = {7, 5, 19};
+    scattered.write_points(std::vector<int>({7, 5, 19}), Data<int>("Scattered", point_values));
+    std::vector<int> slab_values = {-1, -2, -3, -4};
+    scattered.write_slabs({{{0}, {2}}, {{10}, {2}}}, Data<int>("Scattered", slab_values));
+
+    const std::vector<int> expected_scattered = {-1, -2, 0, 0, 0, 5, 0, 7, 0, 0,
+                                                 -3, -4, 0, 0, 0, 0, 0, 0, 0, 19};
+    success = success && (scattered.read<int>() == expected_scattered);
+
+    // scatter rows of a 2D dataset
+    std::vector<double> new_rows = {-1, -1, -1, -1, -2, -2, -2, -2};
+    grid.write_points(std::vector<int>({99, 0}), Data<double>("Grid", {2, 4}, new_rows.data()));
+    success = success && (grid.read<double>({0, 0}, {1, 4}) == std::vector<double>({-2, -2, -2, -2}));
+    success = success && (grid.read<double>({99, 0}, {1, 4}) == std::vector<double>({-1, -1, -1, -1}));
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_points.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
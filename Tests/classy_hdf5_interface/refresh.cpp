@@ -0,0 +1,108 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file
+ * and check the metadata cached by two Dataset
+ * objects open on the same "Indices" array.
+ */
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // store 15 elements in a chunked dataset
+    std::vector<int> xdata(15);
+    for (int i = 0; i < 15; ++i) xdata[i] = i;
+    group.create_dataset(Data<int>("Indices", xdata), {5});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    Dataset writer = group.open_dataset("Indices");
+    Dataset reader = group.open_dataset("Indices");
+
+    bool success = true;
+
+    // the metadata cached when the dataset was opened
+    success = success && (reader.rank() == 1);
+    success = success && (reader.dimensions() == Shape({15}));
+    success = success && (reader.max_dimensions() == Shape({-1}));
+    success = success && (reader.chunk_dimensions() == Shape({5}));
+    success = success && (reader.type_class() == H5T_INTEGER);
+
+    // resizing the dataset updates the cache of the Dataset we resized
+    writer.expand_by({5});
+    success = success && (writer.dimensions()[0] == 20);
+
+    // but the other Dataset sees the new extent only after a refresh
+    success = success && (reader.dimensions()[0] == 15);
+    reader.refresh();
+    success = success && (reader.dimensions()[0] == 20);
+
+    // truncate the dataset and read it back through the refreshed Dataset
+    writer.set_extent({10});
+    reader.refresh();
+
+    const auto xdata = reader.read<int>();
+    success = success && (xdata.size() == 10);
+    for (int i = 0; i < 10; ++i) {
+        success = success && (xdata[i] == i);
+    }
+
+    return success;
+}
+
+bool do_append_test(const std::string& filename) {
+    bool success = true;
+
+    // two Datasets open on the same 4 element dataset each append to it,
+    // and neither overwrites what the other appended
+    {
+        File file(filename, FileMode::trunc);
+        file.create_dataset(Data<int>("Values", {0, 1, 2, 3}), {4});
+
+        Dataset a = file.open_dataset("Values");
+        Dataset b = file.open_dataset("Values");
+        a.append(Data<int>("Values", {4, 5, 6}));
+        b.append(Data<int>("Values", {7, 8}));
+
+        success = success && (b.dimensions()[0] == 9);
+        success = success && (file.read_dataset<int>("Values") == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    }
+
+    // through a handle cache, Datasets on the same handle share their extent
+    {
+        File file(filename, FileMode::trunc, FileOptions().handle_cache(4));
+        file.create_dataset(Data<int>("Values", {0, 1, 2, 3}), {4});
+
+        Dataset earlier = file.open_dataset("Values");
+        file.append(Data<int>("Values", {4, 5}));
+        success = success && (earlier.dimensions()[0] == 6);
+
+        earlier.append(Data<int>("Values", {6}));
+        success = success && (file.read_dataset<int>("Values") == std::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+    }
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_refresh.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename) && do_append_test("file_refresh_append.h5")) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
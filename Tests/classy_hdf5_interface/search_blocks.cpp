@@ -0,0 +1,147 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file
+ * with a long 1D "Steps" array, a 2D "Grid" array and a
+ * 2D "Wide" array large enough to span several search blocks,
+ * and search them block by block.
+ */
+
+// Wide is 4 x wide_columns doubles chunked 4 x 1000, so a search along its
+// columns reads blocks of 32000 columns: [0, 32000), [32000, 64000),
+// [64000, 96000) and a partial last block [96000, 100000)
+const int wide_rows = 4;
+const int wide_columns = 100000;
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc);
+    Group group = file.get_group("Data");
+
+    // a 1D dataset spanning many chunks, with a partial last chunk
+    const int num_steps = 1003;
+    std::vector<int> steps(num_steps);
+    for (int i = 0; i < num_steps; ++i) steps[i] = i % 100;
+    group.create_dataset(Data<int>("Steps", steps), {64});
+
+    // a 6x8 2D dataset, chunked 4x3, holding its flattened index
+    std::vector<double> grid(6 * 8);
+    for (int i = 0; i < 6 * 8; ++i) grid[i] = i;
+    group.create_dataset(Data<double>("Grid", {6, 8}, grid.data()), {4, 3});
+
+    // zeros, with markers in the first, middle and last blocks,
+    // each marker value in a different row
+    std::vector<double> wide(wide_rows * wide_columns, 0.0);
+    auto mark = [&](int row, int column, double value) { wide[row * wide_columns + column] = value; };
+    mark(2, 100, 1.0);
+    mark(0, 50000, 1.0);
+    mark(3, 99990, 1.0);
+    mark(1, 40000, 2.0);
+    mark(3, 60000, 2.0);
+    mark(0, 5, 3.0);
+    mark(2, 31999, 3.0);
+    mark(1, 64000, 4.0);
+    mark(3, 99999, 4.0);
+    group.create_dataset(Data<double>("Wide", {wide_rows, wide_columns}, wide.data()), {4, 1000});
+}
+
+bool do_test(const std::string& filename) {
+    File file(filename);
+    Group group = file.get_group("Data");
+
+    bool success = true;
+
+    // search the 1D dataset from either end
+    Dataset steps = group.open_dataset("Steps");
+    auto is_42 = [](int i) -> bool {return (i==42);};
+    success = success && (steps.search<int>(is_42) == 42);
+    success = success && (steps.search<int>(is_42, true) == 942);
+
+    // the first and last elements are found from both directions
+    auto is_0 = [](int i) -> bool {return (i==0);};
+    auto is_2 = [](int i) -> bool {return (i==2);};
+    success = success && (steps.search<int>(is_0) == 0);
+    success = success && (steps.search<int>(is_0, true) == 1000);
+    success = success && (steps.search<int>(is_2, true) == 1002);
+
+    // a missing element returns -1
+    auto is_negative = [](int i) -> bool {return (i<0);};
+    success = success && (steps.search<int>(is_negative) == -1);
+    success = success && (steps.search<int>(is_negative, true) == -1);
+
+    // a batch predicate gives the same result as the element predicate
+    auto batch_is_42 = [](const int* values, std::size_t count, unsigned char* matches) {
+        for (std::size_t i = 0; i < count; ++i) matches[i] = (values[i] == 42);
+    };
+    success = success && (steps.search<int>(batch_is_42) == 42);
+    success = success && (steps.search<int>(batch_is_42, true) == 942);
+
+    // any nonzero match counts, such as the all-ones masks of SIMD comparisons
+    auto mask_is_42 = [](const int* values, std::size_t count, unsigned char* matches) {
+        for (std::size_t i = 0; i < count; ++i) matches[i] = (values[i] == 42) ? 0xFF : 0;
+    };
+    success = success && (steps.search<int>(mask_is_42) == 42);
+    success = success && (steps.search<int>(mask_is_42, true) == 942);
+
+    // search the 2D dataset along either axis: element 29 is at row 3, column 5
+    Dataset grid = group.open_dataset("Grid");
+    auto is_29 = [](double x) -> bool {return (x==29.0);};
+    success = success && (grid.search<double>(is_29, false, 0) == 3);
+    success = success && (grid.search<double>(is_29, false, 1) == 5);
+
+    // the first row with any element above 20 is row 2,
+    // and the last column with any element below 10 is column 7
+    auto above_20 = [](double x) -> bool {return (x>20.0);};
+    auto below_10 = [](double x) -> bool {return (x<10.0);};
+    success = success && (grid.search<double>(above_20, false, 0) == 2);
+    success = success && (grid.search<double>(below_10, true, 1) == 7);
+
+    // search the wide dataset along its columns, across several blocks
+    Dataset wide = group.open_dataset("Wide");
+    success = success && (wide.block_length(1, wide_rows * sizeof(double)) == 32000);
+
+    auto equals = [](double value) { return [=](double x) -> bool { return x == value; }; };
+
+    // hits in the first and last blocks
+    success = success && (wide.search<double>(equals(1.0), false, 1) == 100);
+    success = success && (wide.search<double>(equals(1.0), true, 1) == 99990);
+
+    // both hits in a middle block
+    success = success && (wide.search<double>(equals(2.0), false, 1) == 40000);
+    success = success && (wide.search<double>(equals(2.0), true, 1) == 60000);
+
+    // searching back through empty blocks to the end of the first block,
+    // and forward through empty blocks to the start of the third
+    success = success && (wide.search<double>(equals(3.0), false, 1) == 5);
+    success = success && (wide.search<double>(equals(3.0), true, 1) == 31999);
+    success = success && (wide.search<double>(equals(4.0), false, 1) == 64000);
+    success = success && (wide.search<double>(equals(4.0), true, 1) == 99999);
+
+    // a missing value reads every block from either end
+    success = success && (wide.search<double>(equals(5.0), false, 1) == -1);
+    success = success && (wide.search<double>(equals(5.0), true, 1) == -1);
+
+    // along the rows, the whole dataset is one block
+    success = success && (wide.search<double>(equals(2.0), false, 0) == 1);
+    success = success && (wide.search<double>(equals(2.0), true, 0) == 3);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_search_blocks.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,116 @@
+#include <iostream>
+#include <string>
+#include <assert.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "ClassyHDF.H"
+
+using namespace ClassyHDF;
+
+/*
+ * We're going to create a "file.h5" HDF5 file with an empty
+ * "Indices" dataset, then append to it from a writer process in
+ * SWMR mode while several reader processes follow it with tail,
+ * each checking that it sees every index exactly once and in order.
+ */
+
+const int num_readers = 3;
+const int num_batches = 50;
+const int batch_size = 20;
+
+void write_test_file(const std::string& filename) {
+    File file(filename, FileMode::trunc, FileOptions().libver_bounds(H5F_LIBVER_LATEST));
+    file.create_dataset<int>("Indices", {0}, {64});
+}
+
+bool read_tail(const std::string& filename, int ready_fd) {
+    // wait for the writer to open the file in SWMR mode
+    char ready;
+    if (read(ready_fd, &ready, 1) != 1) return false;
+
+    File file(filename, FileMode::swmr_read);
+    Dataset dataset = file.open_dataset("Indices");
+
+    // follow the dataset until we have seen every index, giving up after a minute
+    const int num_indices = num_batches * batch_size;
+    int next_index = 0;
+    for (int attempt = 0; attempt < 60000 && next_index < num_indices; ++attempt) {
+        const auto indices = dataset.tail<int>(num_indices);
+        for (const int index : indices) {
+            if (index != next_index) return false;
+            ++next_index;
+        }
+        if (indices.empty()) usleep(1000);
+    }
+
+    return (next_index == num_indices) && (dataset.tail_row() == num_indices);
+}
+
+bool do_test(const std::string& filename) {
+    // start the readers, which wait until the writer is ready
+    int ready_pipe[2];
+    if (pipe(ready_pipe) != 0) return false;
+
+    pid_t readers[num_readers];
+    for (int r = 0; r < num_readers; ++r) {
+        readers[r] = fork();
+        if (readers[r] == 0) {
+            close(ready_pipe[1]);
+            _exit(read_tail(filename, ready_pipe[0]) ? 0 : 1);
+        }
+    }
+    close(ready_pipe[0]);
+
+    bool success = true;
+    {
+        File file(filename, FileMode::swmr_write);
+        Dataset dataset = file.open_dataset("Indices");
+
+        // let the readers open the file
+        const char ready[num_readers] = {};
+        success = success && (write(ready_pipe[1], ready, num_readers) == num_readers);
+        close(ready_pipe[1]);
+
+        // append and publish the batches while the readers follow along
+        for (int b = 0; b < num_batches; ++b) {
+            std::vector<int> batch(batch_size);
+            for (int i = 0; i < batch_size; ++i) batch[i] = b * batch_size + i;
+            dataset.append(Data<int>("Indices", batch));
+            dataset.flush();
+            usleep(2000);
+        }
+    }
+
+    for (int r = 0; r < num_readers; ++r) {
+        int status = 0;
+        const bool reaped = (waitpid(readers[r], &status, 0) == readers[r]);
+        success = success && reaped && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    }
+
+    // the tail of a dataset in a file that is not being written
+    File file(filename);
+    Dataset dataset = file.open_dataset("Indices");
+    const auto last = dataset.tail<int>(3);
+    success = success && (last == std::vector<int>({997, 998, 999}));
+    success = success && dataset.tail<int>(3).empty();
+
+    std::vector<int> more = {1000, 1001};
+    dataset.append(Data<int>("Indices", more));
+    success = success && (dataset.tail<int>(3) == more);
+
+    return success;
+}
+
+int main() {
+    const std::string filename = "file_swmr.h5";
+
+    write_test_file(filename);
+
+    if (do_test(filename)) {
+        std::cout << "success" << std::endl;
+        return 0;
+    } else {
+        std::cout << "failure" << std::endl;
+        return -1;
+    }
+}